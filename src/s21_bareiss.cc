@@ -0,0 +1,129 @@
+#include "s21_bareiss.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+
+#include "s21_matrix_pool.h"
+
+namespace {
+
+template <typename T>
+bool IsIntegral(T x) noexcept {
+  if constexpr (std::is_integral<T>::value) {
+    return true;
+  } else {
+    // 2^63 is exact in every floating type; the range check also rejects
+    // NaN and infinities.
+    constexpr T kLimit = T(9223372036854775808.0);
+    return x >= -kLimit && x < kLimit && std::trunc(x) == x;
+  }
+}
+
+// Bareiss elimination on the n x n matrix m of W, in place. Returns false
+// as soon as a product, difference or quotient overflows W.
+template <typename W>
+bool Eliminate(W* m, int n, __int128& det) {
+  bool negate = false;
+  W prev = 1;
+  for (int k = 0; k < n - 1; ++k) {
+    W* row_k = m + static_cast<long>(k) * n;
+    if (row_k[k] == 0) {
+      int p = k + 1;
+      while (p < n && m[static_cast<long>(p) * n + k] == 0) ++p;
+      if (p == n) {
+        det = 0;
+        return true;
+      }
+      std::swap_ranges(row_k + k, row_k + n, m + static_cast<long>(p) * n + k);
+      negate = !negate;
+    }
+
+    W pivot = row_k[k];
+    for (int i = k + 1; i < n; ++i) {
+      W* row_i = m + static_cast<long>(i) * n;
+      W lead = row_i[k];
+      for (int j = k + 1; j < n; ++j) {
+        W x, y;
+        if (__builtin_mul_overflow(row_i[j], pivot, &x) ||
+            __builtin_mul_overflow(lead, row_k[j], &y) ||
+            __builtin_sub_overflow(x, y, &x))
+          return false;
+        if (prev != -1) {
+          row_i[j] = x / prev;
+        } else if (__builtin_sub_overflow(W(0), x, &row_i[j])) {
+          // The most negative W divided by -1 traps instead of wrapping.
+          return false;
+        }
+      }
+    }
+    prev = pivot;
+  }
+
+  W last = m[static_cast<long>(n) * n - 1];
+  if (negate && __builtin_sub_overflow(W(0), last, &last)) return false;
+  det = last;
+
+  return true;
+}
+
+template <typename W, typename T>
+bool Determinant(const T* a, int n, int lda, __int128& det) {
+  // Matrices up to 4 x 4 are eliminated on the stack, like the elements
+  // S21MatrixT keeps inline.
+  W local[16];
+  long size = static_cast<long>(n) * n;
+  W* m = size <= 16 ? local
+                    : static_cast<W*>(
+                          S21MatrixPool::Local().Allocate(sizeof(W) * size));
+  for (int i = 0; i < n; ++i) {
+    const T* row = a + static_cast<long>(i) * lda;
+    std::transform(row, row + n, m + static_cast<long>(i) * n,
+                   [](T x) { return static_cast<W>(x); });
+  }
+  bool res_ = Eliminate(m, n, det);
+  if (m != local) S21MatrixPool::Release(m);
+
+  return res_;
+}
+
+}  // namespace
+
+template <typename T>
+bool S21IsIntegral(const T* a, int rows, int cols, int lda) noexcept {
+  for (int i = 0; i < rows; ++i) {
+    const T* row = a + static_cast<long>(i) * lda;
+    for (int j = 0; j < cols; ++j) {
+      if (!IsIntegral(row[j])) return false;
+    }
+  }
+
+  return true;
+}
+
+template <typename T>
+__int128 S21BareissDeterminant(const T* a, int n, int lda) {
+  if (!S21IsIntegral(a, n, n, lda))
+    throw std::invalid_argument("Matrix must have integer elements");
+
+  // The empty product; Eliminate reads the last element.
+  if (n == 0) return 1;
+
+  __int128 det = 0;
+  if (!Determinant<long long>(a, n, lda, det) &&
+      !Determinant<__int128>(a, n, lda, det))
+    throw std::overflow_error("Determinant exceeds 128-bit arithmetic");
+
+  return det;
+}
+
+template bool S21IsIntegral(const long long*, int, int, int) noexcept;
+template bool S21IsIntegral(const float*, int, int, int) noexcept;
+template bool S21IsIntegral(const double*, int, int, int) noexcept;
+template bool S21IsIntegral(const long double*, int, int, int) noexcept;
+
+template __int128 S21BareissDeterminant(const long long*, int, int);
+template __int128 S21BareissDeterminant(const float*, int, int);
+template __int128 S21BareissDeterminant(const double*, int, int);
+template __int128 S21BareissDeterminant(const long double*, int, int);
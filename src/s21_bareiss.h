@@ -0,0 +1,20 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_S21_BAREISS_H_
+#define CPP1_S21_MATRIXPLUS_1_S21_BAREISS_H_
+
+// True when every element of the rows x cols row-major block at a is an
+// integer that fits in a long long.
+template <typename T>
+bool S21IsIntegral(const T* a, int rows, int cols, int lda) noexcept;
+
+// Exact determinant of the n x n row-major integer matrix at a by Bareiss'
+// fraction-free elimination: every step divides exactly by the previous
+// pivot, so entries stay integers bounded by the minors of A and the cost
+// is O(n^3) with one pooled workspace per call. Elimination runs in long
+// long and, if a product overflows, restarts once in 128-bit arithmetic.
+// Throws std::invalid_argument if a is not S21IsIntegral and
+// std::overflow_error if a 128-bit intermediate overflows as well.
+// Instantiated for long long and the real S21MatrixT element types.
+template <typename T>
+__int128 S21BareissDeterminant(const T* a, int n, int lda);
+
+#endif  // CPP1_S21_MATRIXPLUS_1_S21_BAREISS_H_
@@ -0,0 +1,393 @@
+#include "s21_cholesky.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <functional>
+#include <stdexcept>
+
+#include "s21_gemm.h"
+#include "s21_matrix_pool.h"
+#include "s21_thread_pool.h"
+
+namespace {
+
+constexpr int kBlock = 64;
+// Panels and trailing updates of at least this many rows run on
+// S21ThreadPool, one kBlock row block per task.
+constexpr int kParallelRows = 256;
+
+template <typename T>
+T Conj(T x) noexcept {
+  if constexpr (S21ScalarTraits<T>::kIsComplex) {
+    return std::conj(x);
+  } else {
+    return x;
+  }
+}
+
+template <typename T>
+typename S21ScalarTraits<T>::real_type RealPart(T x) noexcept {
+  if constexpr (S21ScalarTraits<T>::kIsComplex) {
+    return x.real();
+  } else {
+    return x;
+  }
+}
+
+// x[0, count) . conj(y[0, count))
+template <typename T>
+T Dot(const T* x, const T* y, int count) noexcept {
+  T sum = 0;
+  for (int p = 0; p < count; ++p) sum += x[p] * Conj(y[p]);
+
+  return sum;
+}
+
+void ForEachBlock(bool parallel, int tasks,
+                  const std::function<void(int)>& fn) {
+  if (parallel) {
+    S21ThreadPool::Instance().ParallelFor(tasks, fn);
+  } else {
+    for (int task = 0; task < tasks; ++task) fn(task);
+  }
+}
+
+// Left-looking factorization of the n x n diagonal block at a, whose
+// earlier panels have already been subtracted. Returns n or the first
+// column with a non-positive pivot.
+template <typename T>
+int FactorDiagonal(T* a, int n, int lda) {
+  using Real = typename S21ScalarTraits<T>::real_type;
+  for (int j = 0; j < n; ++j) {
+    T* row_j = a + static_cast<long>(j) * lda;
+    Real pivot = RealPart(row_j[j] - Dot(row_j, row_j, j));
+    if (!(pivot > 0)) return j;
+
+    Real diag = std::sqrt(pivot);
+    row_j[j] = diag;
+    for (int i = j + 1; i < n; ++i) {
+      T* row_i = a + static_cast<long>(i) * lda;
+      row_i[j] = (row_i[j] - Dot(row_i, row_j, j)) / diag;
+    }
+  }
+
+  return n;
+}
+
+// rows rows of the panel below the n x n diagonal block l:
+// A21 = A21 * L11^-H, one independent triangular solve per row.
+template <typename T>
+void SolvePanel(const T* l, int n, int lda, T* panel, int rows) {
+  for (int i = 0; i < rows; ++i) {
+    T* row_i = panel + static_cast<long>(i) * lda;
+    for (int j = 0; j < n; ++j) {
+      const T* row_j = l + static_cast<long>(j) * lda;
+      row_i[j] = (row_i[j] - Dot(row_i, row_j, j)) / row_j[j];
+    }
+  }
+}
+
+// Writes the inverse of the n x n lower triangular l to the lower triangle
+// of x, whose upper triangle must be zero.
+template <typename T>
+void InvertLower(const T* l, int n, int ldl, T* x, int ldx) {
+  for (int i = 0; i < n; ++i) {
+    const T* l_row = l + static_cast<long>(i) * ldl;
+    T* row_i = x + static_cast<long>(i) * ldx;
+    for (int k = 0; k < i; ++k) {
+      const T* row_k = x + static_cast<long>(k) * ldx;
+      for (int j = 0; j <= k; ++j) row_i[j] -= l_row[k] * row_k[j];
+    }
+    T inv_diag = T(1) / l_row[i];
+    for (int j = 0; j < i; ++j) row_i[j] *= inv_diag;
+    row_i[i] = inv_diag;
+  }
+}
+
+}  // namespace
+
+template <typename T>
+int S21CholeskyDecompose(T* a, int n, int lda) {
+  S21ThreadPool& pool = S21ThreadPool::Instance();
+  bool threads = pool.GetThreadCount() > 1;
+
+  // C -= A21 * A21^H goes through S21Gemm's plain transpose, so complex
+  // panels are conjugated into a scratch copy first.
+  T* conj = nullptr;
+  int ldc = kBlock;
+  if constexpr (S21ScalarTraits<T>::kIsComplex) {
+    if (n > kBlock) {
+      conj = static_cast<T*>(S21MatrixPool::Local().Allocate(
+          sizeof(T) * static_cast<long>(n) * kBlock));
+    }
+  }
+
+  int res_ = n;
+  for (int k0 = 0; k0 < n; k0 += kBlock) {
+    int kb = std::min(kBlock, n - k0);
+    T* diag = a + static_cast<long>(k0) * lda + k0;
+    int done = FactorDiagonal(diag, kb, lda);
+    if (done < kb) {
+      res_ = k0 + done;
+      break;
+    }
+
+    int start = k0 + kb, rest = n - start;
+    if (rest == 0) break;
+    bool parallel = threads && rest >= kParallelRows;
+    int blocks = (rest + kBlock - 1) / kBlock;
+    auto panel_row = [&](int i) {
+      return a + static_cast<long>(i) * lda + k0;
+    };
+
+    ForEachBlock(parallel, blocks, [&](int task) {
+      int i0 = start + task * kBlock;
+      SolvePanel(diag, kb, lda, panel_row(i0), std::min(kBlock, n - i0));
+    });
+
+    const T* b = panel_row(start);
+    int ldb = lda;
+    if constexpr (S21ScalarTraits<T>::kIsComplex) {
+      for (int i = 0; i < rest; ++i) {
+        const T* row = panel_row(start + i);
+        std::transform(row, row + kb, conj + static_cast<long>(i) * ldc,
+                       [](T x) { return std::conj(x); });
+      }
+      b = conj;
+      ldb = ldc;
+    }
+
+    // Lower triangle of the trailing matrix, one row block per task and the
+    // widest blocks first: S21Gemm left of the diagonal block, dot
+    // products inside it.
+    ForEachBlock(parallel, blocks, [&](int task) {
+      int i0 = start + (blocks - 1 - task) * kBlock;
+      int rows = std::min(kBlock, n - i0);
+      T* c = a + static_cast<long>(i0) * lda;
+      if (i0 > start) {
+        S21Gemm(false, true, rows, i0 - start, kb, T(-1), panel_row(i0), lda,
+                b, ldb, T(1), c + start, lda);
+      }
+      for (int i = 0; i < rows; ++i) {
+        const T* row_i = panel_row(i0 + i);
+        T* c_row = c + static_cast<long>(i) * lda;
+        for (int j = i0; j <= i0 + i; ++j) {
+          c_row[j] -= Dot(row_i, panel_row(j), kb);
+        }
+      }
+    });
+  }
+  if (conj) S21MatrixPool::Release(conj);
+
+  return res_;
+}
+
+template <typename T>
+void S21CholeskySolve(const T* l, int n, int lda, T* b, int nrhs, int ldb) {
+  for (int i = 0; i < n; ++i) {
+    const T* l_row = l + static_cast<long>(i) * lda;
+    T* row_i = b + static_cast<long>(i) * ldb;
+    for (int k = 0; k < i; ++k) {
+      const T* row_k = b + static_cast<long>(k) * ldb;
+      for (int j = 0; j < nrhs; ++j) row_i[j] -= l_row[k] * row_k[j];
+    }
+    T inv_diag = T(1) / l_row[i];
+    for (int j = 0; j < nrhs; ++j) row_i[j] *= inv_diag;
+  }
+
+  for (int k = n - 1; k >= 0; --k) {
+    const T* l_row = l + static_cast<long>(k) * lda;
+    T* row_k = b + static_cast<long>(k) * ldb;
+    T inv_diag = T(1) / l_row[k];
+    for (int j = 0; j < nrhs; ++j) row_k[j] *= inv_diag;
+    for (int i = 0; i < k; ++i) {
+      T u = Conj(l_row[i]);
+      T* row_i = b + static_cast<long>(i) * ldb;
+      for (int j = 0; j < nrhs; ++j) row_i[j] -= u * row_k[j];
+    }
+  }
+}
+
+template <typename T>
+S21CholeskyT<T>::S21CholeskyT(const S21MatrixT<T>& matrix,
+                              real_type symmetry_tolerance)
+    : S21CholeskyT(S21MatrixViewT<T>(matrix), symmetry_tolerance) {}
+
+template <typename T>
+S21CholeskyT<T>::S21CholeskyT(const S21MatrixViewT<T>& matrix,
+                              real_type symmetry_tolerance)
+    : size_(matrix.GetRows()), positive_(false) {
+  if (matrix.GetRows() != matrix.GetCols())
+    throw std::logic_error("Matrix must be square");
+
+  // Written as !(x <= tolerance) so that NaN elements fail the check.
+  for (int i = 0; i < size_; ++i) {
+    T diag = matrix.Get(i, i);
+    if (!(RealPart(diag) > 0) ||
+        !(std::abs(diag - Conj(diag)) <= symmetry_tolerance))
+      return;
+  }
+  for (int i = 1; i < size_; ++i) {
+    for (int j = 0; j < i; ++j) {
+      T diff = matrix.Get(i, j) - Conj(matrix.Get(j, i));
+      if (!(std::abs(diff) <= symmetry_tolerance)) return;
+    }
+  }
+
+  l_ = S21MatrixT<T>(matrix);
+  positive_ = S21CholeskyDecompose(l_.Data(), size_, l_.GetStride()) == size_;
+}
+
+template <typename T>
+int S21CholeskyT<T>::GetSize() const noexcept {
+  return size_;
+}
+
+template <typename T>
+bool S21CholeskyT<T>::IsPositiveDefinite() const noexcept {
+  return positive_;
+}
+
+template <typename T>
+T S21CholeskyT<T>::Determinant() const {
+  CheckPositiveDefinite();
+  T det_ = 1;
+  for (int i = 0; i < size_; ++i) det_ *= l_.RowPtr(i)[i] * l_.RowPtr(i)[i];
+
+  return det_;
+}
+
+template <typename T>
+S21LogDeterminant<T> S21CholeskyT<T>::LogAbsDeterminant() const {
+  CheckPositiveDefinite();
+  S21LogDeterminant<T> res_{T(1), 0};
+  for (int i = 0; i < size_; ++i) {
+    res_.log_abs += std::log(RealPart(l_.RowPtr(i)[i]));
+  }
+  res_.log_abs *= 2;
+
+  return res_;
+}
+
+template <typename T>
+std::vector<T> S21CholeskyT<T>::Solve(const std::vector<T>& b) const {
+  if (static_cast<int>(b.size()) != size_)
+    throw std::logic_error("Right-hand side must match the matrix size");
+
+  CheckSingular();
+  std::vector<T> x_(b);
+  S21CholeskySolve(l_.Data(), size_, l_.GetStride(), x_.data(), 1, 1);
+
+  return x_;
+}
+
+template <typename T>
+S21MatrixT<T> S21CholeskyT<T>::Solve(const S21MatrixT<T>& b) const {
+  if (b.GetRows() != size_)
+    throw std::logic_error("Right-hand side must match the matrix size");
+
+  CheckSingular();
+  S21MatrixT<T> x_(b);
+  S21CholeskySolve(l_.Data(), size_, l_.GetStride(), x_.Data(), x_.GetCols(),
+                   x_.GetStride());
+
+  return x_;
+}
+
+template <typename T>
+S21MatrixT<T> S21CholeskyT<T>::Inverse() const {
+  CheckSingular();
+
+  int n = size_, blocks = (n + kBlock - 1) / kBlock;
+  bool parallel = S21ThreadPool::Instance().GetThreadCount() > 1 &&
+                  n >= kParallelRows;
+  const T* l = l_.Data();
+  int ldl = l_.GetStride();
+  S21MatrixT<T> x(n, n);
+  int ldx = x.GetStride();
+  auto x_at = [&](int i, int j) {
+    return x.Data() + static_cast<long>(i) * ldx + j;
+  };
+
+  // X = L^-1 by blocks: X_II = L_II^-1, then down each block column
+  // X_IJ = -X_II * L_I[J, I) * X[J, I)J, the last two factors by S21Gemm.
+  ForEachBlock(parallel, blocks, [&](int task) {
+    int i0 = task * kBlock;
+    InvertLower(l + static_cast<long>(i0) * ldl + i0,
+                std::min(kBlock, n - i0), ldl, x_at(i0, i0), ldx);
+  });
+  ForEachBlock(parallel, blocks - 1, [&](int task) {
+    int j0 = task * kBlock, cols = std::min(kBlock, n - j0);
+    T* work = static_cast<T*>(
+        S21MatrixPool::Local().Allocate(sizeof(T) * kBlock * kBlock));
+    for (int i0 = j0 + kBlock; i0 < n; i0 += kBlock) {
+      int rows = std::min(kBlock, n - i0);
+      S21Gemm(false, false, rows, cols, i0 - j0, T(1),
+              l + static_cast<long>(i0) * ldl + j0, ldl, x_at(j0, j0), ldx,
+              T(0), work, kBlock);
+      S21Gemm(false, false, rows, cols, rows, T(-1), x_at(i0, i0), ldx, work,
+              kBlock, T(0), x_at(i0, j0), ldx);
+    }
+    S21MatrixPool::Release(work);
+  });
+
+  // inv(A) = X^H * X. Block (I, J) with I >= J only needs rows of X from
+  // I on; the upper triangle is mirrored from the lower one.
+  const T* x_h = x.Data();
+  S21MatrixT<T> conj;
+  if constexpr (S21ScalarTraits<T>::kIsComplex) {
+    conj = x;
+    for (int i = 0; i < n; ++i) {
+      T* row = conj.RowPtr(i);
+      std::transform(row, row + n, row, [](T v) { return std::conj(v); });
+    }
+    x_h = conj.Data();
+  }
+  S21MatrixT<T> res_(n, n);
+  ForEachBlock(parallel, blocks * blocks, [&](int task) {
+    int i0 = task / blocks * kBlock, j0 = task % blocks * kBlock;
+    if (j0 > i0) return;
+    S21Gemm(true, false, std::min(kBlock, n - i0), std::min(kBlock, n - j0),
+            n - i0, T(1), x_h + static_cast<long>(i0) * ldx + i0, ldx,
+            x_at(i0, j0), ldx, T(0), res_.RowPtr(i0) + j0, res_.GetStride());
+  });
+  for (int i = 0; i < n; ++i) {
+    for (int j = i + 1; j < n; ++j) res_.RowPtr(i)[j] = Conj(res_.RowPtr(j)[i]);
+  }
+
+  return res_;
+}
+
+template <typename T>
+void S21CholeskyT<T>::CheckPositiveDefinite() const {
+  if (!positive_)
+    throw std::logic_error("Matrix must be symmetric positive definite");
+}
+
+template <typename T>
+void S21CholeskyT<T>::CheckSingular() const {
+  using Real = typename S21ScalarTraits<T>::real_type;
+  if (size_ < 1) throw std::logic_error("Matrix must be non-zero");
+
+  if (LogAbsDeterminant().log_abs <= std::log(Real(1e-6)))
+    throw std::logic_error(
+        "The determinant of the matrix cannot be equal to zero");
+}
+
+template class S21CholeskyT<float>;
+template class S21CholeskyT<double>;
+template class S21CholeskyT<long double>;
+template class S21CholeskyT<std::complex<double>>;
+
+template int S21CholeskyDecompose(float*, int, int);
+template int S21CholeskyDecompose(double*, int, int);
+template int S21CholeskyDecompose(long double*, int, int);
+template int S21CholeskyDecompose(std::complex<double>*, int, int);
+
+template void S21CholeskySolve(const float*, int, int, float*, int, int);
+template void S21CholeskySolve(const double*, int, int, double*, int, int);
+template void S21CholeskySolve(const long double*, int, int, long double*,
+                               int, int);
+template void S21CholeskySolve(const std::complex<double>*, int, int,
+                               std::complex<double>*, int, int);
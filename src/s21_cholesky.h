@@ -0,0 +1,63 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_S21_CHOLESKY_H_
+#define CPP1_S21_MATRIXPLUS_1_S21_CHOLESKY_H_
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// Cholesky factorization A = L * L^H of a symmetric (for complex T,
+// Hermitian) positive definite matrix. It costs about half the flops of
+// S21LUT and needs no pivoting. Construction doubles as the positive
+// definiteness check: it stops at the first non-positive or non-real
+// diagonal element, the first pair with |a(i, j) - conj(a(j, i))| above
+// symmetry_tolerance or the first non-positive pivot; only the lower
+// triangle is factorized, so a positive tolerance yields the answer for the
+// matrix mirrored from that triangle. Determinant, InverseMatrix and Solve
+// of S21MatrixT always use S21LUT; callers that know their matrix is SPD,
+// such as a covariance matrix, construct this class instead.
+template <typename T>
+class S21CholeskyT {
+ public:
+  using real_type = typename S21ScalarTraits<T>::real_type;
+
+  explicit S21CholeskyT(const S21MatrixT<T>& matrix,
+                        real_type symmetry_tolerance = 0);
+  explicit S21CholeskyT(const S21MatrixViewT<T>& matrix,
+                        real_type symmetry_tolerance = 0);
+
+  int GetSize() const noexcept;
+  bool IsPositiveDefinite() const noexcept;
+  // The remaining members throw std::logic_error unless
+  // IsPositiveDefinite(). Solve and Inverse also refuse |det| <= 1e-6,
+  // like S21LUT.
+  T Determinant() const;
+  S21LogDeterminant<T> LogAbsDeterminant() const;
+  std::vector<T> Solve(const std::vector<T>& b) const;
+  S21MatrixT<T> Solve(const S21MatrixT<T>& b) const;
+  S21MatrixT<T> Inverse() const;
+
+ private:
+  void CheckPositiveDefinite() const;
+  void CheckSingular() const;
+
+  S21MatrixT<T> l_;
+  int size_;
+  bool positive_;
+};
+
+using S21Cholesky = S21CholeskyT<double>;
+
+// Overwrites the lower triangle of the n x n row-major matrix a with L,
+// reading nothing above the diagonal. Works in 64-column panels whose
+// trailing update runs through S21Gemm, split across S21ThreadPool for
+// large n. Returns n, or the index of the first pivot that is not positive,
+// in which case a is left partially factorized.
+template <typename T>
+int S21CholeskyDecompose(T* a, int n, int lda);
+
+// Overwrites the n x nrhs row-major matrix b with the solution X of
+// L * L^H * X = B, given the output of S21CholeskyDecompose.
+template <typename T>
+void S21CholeskySolve(const T* l, int n, int lda, T* b, int nrhs, int ldb);
+
+#endif  // CPP1_S21_MATRIXPLUS_1_S21_CHOLESKY_H_
@@ -0,0 +1,423 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_S21_FIXED_MATRIX_H_
+#define CPP1_S21_MATRIXPLUS_1_S21_FIXED_MATRIX_H_
+
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_matrix_oop.h"
+
+template <typename F, int... I>
+constexpr void S21UnrollImpl(F& f, std::integer_sequence<int, I...>) {
+  (f(std::integral_constant<int, I>()), ...);
+}
+
+// Calls f(std::integral_constant<int, I>()) for I = 0 .. N - 1 as a
+// compile-time sequence of calls rather than a loop.
+template <int N, typename F>
+constexpr void S21Unroll(F&& f) {
+  S21UnrollImpl(f, std::make_integer_sequence<int, N>());
+}
+
+// R x C matrix of T held by value, for small transforms where a heap
+// buffer, runtime size checks and pivoting cost more than the arithmetic.
+// Sizes are part of the type, so mismatched operands do not compile, and
+// every operation is constexpr and unrolled over the compile-time extents.
+// Determinant and InverseMatrix use closed forms up to 4 x 4 and
+// partial-pivot elimination above that.
+template <int R, int C, typename T = double>
+class S21FixedMatrix {
+  static_assert(R > 0 && C > 0,
+                "Incorrect input, matrix should have positive size");
+  static_assert(std::is_floating_point<T>::value,
+                "Fixed matrices hold real floating-point values");
+
+ public:
+  using value_type = T;
+
+  // Zero matrix.
+  constexpr S21FixedMatrix() noexcept : data_{} {}
+  // All R * C elements in row-major order.
+  template <typename... Values,
+            typename = std::enable_if_t<sizeof...(Values) == R * C &&
+                                        (R * C > 1) &&
+                                        (std::is_arithmetic<Values>::value &&
+                                         ...)>>
+  constexpr S21FixedMatrix(Values... values) noexcept
+      : data_{static_cast<T>(values)...} {}
+  // Copies a dynamic matrix or view of exactly R x C elements.
+  explicit S21FixedMatrix(const S21MatrixViewT<T>& matrix);
+
+  static constexpr S21FixedMatrix Identity() noexcept;
+
+  static constexpr int GetRows() noexcept { return R; }
+  static constexpr int GetCols() noexcept { return C; }
+
+  constexpr T& Get(int i, int j) noexcept { return data_[i][j]; }
+  constexpr T Get(int i, int j) const noexcept { return data_[i][j]; }
+  constexpr T& operator()(int i, int j);
+  constexpr T operator()(int i, int j) const;
+  constexpr const T* Data() const noexcept { return &data_[0][0]; }
+  // Reads the elements in place, e.g. to mix them with S21MatrixT.
+  S21MatrixViewT<T> View() const noexcept { return {Data(), R, C, C}; }
+  explicit operator S21MatrixT<T>() const;
+
+  constexpr void SumMatrix(const S21FixedMatrix& other) noexcept;
+  constexpr void SubMatrix(const S21FixedMatrix& other) noexcept;
+  constexpr void MulNumber(const T num) noexcept;
+  constexpr void MulMatrix(const S21FixedMatrix<C, C, T>& other) noexcept;
+  bool EqMatrix(const S21FixedMatrix& other) const noexcept;
+  constexpr S21FixedMatrix<C, R, T> Transpose() const noexcept;
+  constexpr T Determinant() const noexcept;
+  constexpr S21FixedMatrix InverseMatrix() const;
+
+  template <int K>
+  constexpr S21FixedMatrix<R, K, T> operator*(
+      const S21FixedMatrix<C, K, T>& other) const noexcept;
+  constexpr S21FixedMatrix operator+(
+      const S21FixedMatrix& other) const noexcept;
+  constexpr S21FixedMatrix operator-(
+      const S21FixedMatrix& other) const noexcept;
+  constexpr S21FixedMatrix operator*(const T num) const noexcept;
+  constexpr S21FixedMatrix& operator+=(const S21FixedMatrix& other) noexcept;
+  constexpr S21FixedMatrix& operator-=(const S21FixedMatrix& other) noexcept;
+  constexpr S21FixedMatrix& operator*=(
+      const S21FixedMatrix<C, C, T>& other) noexcept;
+  constexpr S21FixedMatrix& operator*=(const T num) noexcept;
+  bool operator==(const S21FixedMatrix& other) const noexcept;
+
+ private:
+  template <int, int, typename>
+  friend class S21FixedMatrix;
+
+  // Partial-pivot elimination for the sizes without a closed form. Returns
+  // the determinant and, when inverse is not null, writes the inverse there.
+  constexpr T Eliminate(S21FixedMatrix* inverse) const;
+
+  T data_[R][C];
+};
+
+template <int R, int C, typename T>
+constexpr S21FixedMatrix<R, C, T> operator*(
+    const T num, const S21FixedMatrix<R, C, T>& matrix) noexcept {
+  return matrix * num;
+}
+
+template <int R, int C, typename T>
+S21FixedMatrix<R, C, T>::S21FixedMatrix(const S21MatrixViewT<T>& matrix)
+    : data_{} {
+  if (matrix.GetRows() != R || matrix.GetCols() != C)
+    throw std::logic_error("Matrices must be of the same dimension");
+
+  S21Unroll<R>([&](auto i) {
+    S21Unroll<C>([&](auto j) { data_[i][j] = matrix.Get(i, j); });
+  });
+}
+
+template <int R, int C, typename T>
+constexpr S21FixedMatrix<R, C, T> S21FixedMatrix<R, C, T>::Identity() noexcept {
+  static_assert(R == C, "Matrix must be square");
+
+  S21FixedMatrix res_;
+  S21Unroll<R>([&](auto i) { res_.data_[i][i] = T(1); });
+
+  return res_;
+}
+
+template <int R, int C, typename T>
+constexpr T& S21FixedMatrix<R, C, T>::operator()(int i, int j) {
+  if (i >= R || j >= C || i < 0 || j < 0)
+    throw std::out_of_range("Incorrect input, index is out of range");
+
+  return data_[i][j];
+}
+
+template <int R, int C, typename T>
+constexpr T S21FixedMatrix<R, C, T>::operator()(int i, int j) const {
+  if (i >= R || j >= C || i < 0 || j < 0)
+    throw std::out_of_range("Incorrect input, index is out of range");
+
+  return data_[i][j];
+}
+
+template <int R, int C, typename T>
+S21FixedMatrix<R, C, T>::operator S21MatrixT<T>() const {
+  return S21MatrixT<T>(View());
+}
+
+template <int R, int C, typename T>
+constexpr void S21FixedMatrix<R, C, T>::SumMatrix(
+    const S21FixedMatrix& other) noexcept {
+  S21Unroll<R>([&](auto i) {
+    S21Unroll<C>([&](auto j) { data_[i][j] += other.data_[i][j]; });
+  });
+}
+
+template <int R, int C, typename T>
+constexpr void S21FixedMatrix<R, C, T>::SubMatrix(
+    const S21FixedMatrix& other) noexcept {
+  S21Unroll<R>([&](auto i) {
+    S21Unroll<C>([&](auto j) { data_[i][j] -= other.data_[i][j]; });
+  });
+}
+
+template <int R, int C, typename T>
+constexpr void S21FixedMatrix<R, C, T>::MulNumber(const T num) noexcept {
+  S21Unroll<R>([&](auto i) {
+    S21Unroll<C>([&](auto j) { data_[i][j] *= num; });
+  });
+}
+
+template <int R, int C, typename T>
+constexpr void S21FixedMatrix<R, C, T>::MulMatrix(
+    const S21FixedMatrix<C, C, T>& other) noexcept {
+  *this = *this * other;
+}
+
+template <int R, int C, typename T>
+bool S21FixedMatrix<R, C, T>::EqMatrix(
+    const S21FixedMatrix& other) const noexcept {
+  T eps = S21MatrixT<T>::GetEqTolerance();
+  bool equal = true;
+  S21Unroll<R>([&](auto i) {
+    S21Unroll<C>([&](auto j) {
+      equal &= std::fabs(data_[i][j] - other.data_[i][j]) <= eps;
+    });
+  });
+
+  return equal;
+}
+
+template <int R, int C, typename T>
+constexpr S21FixedMatrix<C, R, T> S21FixedMatrix<R, C, T>::Transpose()
+    const noexcept {
+  S21FixedMatrix<C, R, T> res_;
+  S21Unroll<R>([&](auto i) {
+    S21Unroll<C>([&](auto j) { res_.data_[j][i] = data_[i][j]; });
+  });
+
+  return res_;
+}
+
+template <int R, int C, typename T>
+constexpr T S21FixedMatrix<R, C, T>::Determinant() const noexcept {
+  static_assert(R == C, "Matrix must be square");
+
+  const auto& a = data_;
+  if constexpr (R == 1) {
+    return a[0][0];
+  } else if constexpr (R == 2) {
+    return a[0][0] * a[1][1] - a[0][1] * a[1][0];
+  } else if constexpr (R == 3) {
+    return a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1]) -
+           a[0][1] * (a[1][0] * a[2][2] - a[1][2] * a[2][0]) +
+           a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+  } else if constexpr (R == 4) {
+    // 2 x 2 minors of the top and bottom row pairs, Laplace-expanded.
+    T s0 = a[0][0] * a[1][1] - a[1][0] * a[0][1];
+    T s1 = a[0][0] * a[1][2] - a[1][0] * a[0][2];
+    T s2 = a[0][0] * a[1][3] - a[1][0] * a[0][3];
+    T s3 = a[0][1] * a[1][2] - a[1][1] * a[0][2];
+    T s4 = a[0][1] * a[1][3] - a[1][1] * a[0][3];
+    T s5 = a[0][2] * a[1][3] - a[1][2] * a[0][3];
+    T c5 = a[2][2] * a[3][3] - a[3][2] * a[2][3];
+    T c4 = a[2][1] * a[3][3] - a[3][1] * a[2][3];
+    T c3 = a[2][1] * a[3][2] - a[3][1] * a[2][2];
+    T c2 = a[2][0] * a[3][3] - a[3][0] * a[2][3];
+    T c1 = a[2][0] * a[3][2] - a[3][0] * a[2][2];
+    T c0 = a[2][0] * a[3][1] - a[3][0] * a[2][1];
+    return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+  } else {
+    return Eliminate(nullptr);
+  }
+}
+
+template <int R, int C, typename T>
+constexpr S21FixedMatrix<R, C, T> S21FixedMatrix<R, C, T>::InverseMatrix()
+    const {
+  static_assert(R == C, "Matrix must be square");
+
+  const auto& a = data_;
+  S21FixedMatrix res_;
+  auto& b = res_.data_;
+  T det = R > 4 ? Eliminate(&res_) : Determinant();
+  if ((det < 0 ? -det : det) <= T(1e-6))
+    throw std::logic_error(
+        "The determinant of the matrix cannot be equal to zero");
+
+  T inv = T(1) / det;
+  if constexpr (R == 1) {
+    b[0][0] = inv;
+  } else if constexpr (R == 2) {
+    b[0][0] = a[1][1] * inv;
+    b[0][1] = -a[0][1] * inv;
+    b[1][0] = -a[1][0] * inv;
+    b[1][1] = a[0][0] * inv;
+  } else if constexpr (R == 3) {
+    b[0][0] = (a[1][1] * a[2][2] - a[1][2] * a[2][1]) * inv;
+    b[0][1] = (a[0][2] * a[2][1] - a[0][1] * a[2][2]) * inv;
+    b[0][2] = (a[0][1] * a[1][2] - a[0][2] * a[1][1]) * inv;
+    b[1][0] = (a[1][2] * a[2][0] - a[1][0] * a[2][2]) * inv;
+    b[1][1] = (a[0][0] * a[2][2] - a[0][2] * a[2][0]) * inv;
+    b[1][2] = (a[0][2] * a[1][0] - a[0][0] * a[1][2]) * inv;
+    b[2][0] = (a[1][0] * a[2][1] - a[1][1] * a[2][0]) * inv;
+    b[2][1] = (a[0][1] * a[2][0] - a[0][0] * a[2][1]) * inv;
+    b[2][2] = (a[0][0] * a[1][1] - a[0][1] * a[1][0]) * inv;
+  } else if constexpr (R == 4) {
+    T s0 = a[0][0] * a[1][1] - a[1][0] * a[0][1];
+    T s1 = a[0][0] * a[1][2] - a[1][0] * a[0][2];
+    T s2 = a[0][0] * a[1][3] - a[1][0] * a[0][3];
+    T s3 = a[0][1] * a[1][2] - a[1][1] * a[0][2];
+    T s4 = a[0][1] * a[1][3] - a[1][1] * a[0][3];
+    T s5 = a[0][2] * a[1][3] - a[1][2] * a[0][3];
+    T c5 = a[2][2] * a[3][3] - a[3][2] * a[2][3];
+    T c4 = a[2][1] * a[3][3] - a[3][1] * a[2][3];
+    T c3 = a[2][1] * a[3][2] - a[3][1] * a[2][2];
+    T c2 = a[2][0] * a[3][3] - a[3][0] * a[2][3];
+    T c1 = a[2][0] * a[3][2] - a[3][0] * a[2][2];
+    T c0 = a[2][0] * a[3][1] - a[3][0] * a[2][1];
+    b[0][0] = (a[1][1] * c5 - a[1][2] * c4 + a[1][3] * c3) * inv;
+    b[0][1] = (-a[0][1] * c5 + a[0][2] * c4 - a[0][3] * c3) * inv;
+    b[0][2] = (a[3][1] * s5 - a[3][2] * s4 + a[3][3] * s3) * inv;
+    b[0][3] = (-a[2][1] * s5 + a[2][2] * s4 - a[2][3] * s3) * inv;
+    b[1][0] = (-a[1][0] * c5 + a[1][2] * c2 - a[1][3] * c1) * inv;
+    b[1][1] = (a[0][0] * c5 - a[0][2] * c2 + a[0][3] * c1) * inv;
+    b[1][2] = (-a[3][0] * s5 + a[3][2] * s2 - a[3][3] * s1) * inv;
+    b[1][3] = (a[2][0] * s5 - a[2][2] * s2 + a[2][3] * s1) * inv;
+    b[2][0] = (a[1][0] * c4 - a[1][1] * c2 + a[1][3] * c0) * inv;
+    b[2][1] = (-a[0][0] * c4 + a[0][1] * c2 - a[0][3] * c0) * inv;
+    b[2][2] = (a[3][0] * s4 - a[3][1] * s2 + a[3][3] * s0) * inv;
+    b[2][3] = (-a[2][0] * s4 + a[2][1] * s2 - a[2][3] * s0) * inv;
+    b[3][0] = (-a[1][0] * c3 + a[1][1] * c1 - a[1][2] * c0) * inv;
+    b[3][1] = (a[0][0] * c3 - a[0][1] * c1 + a[0][2] * c0) * inv;
+    b[3][2] = (-a[3][0] * s3 + a[3][1] * s1 - a[3][2] * s0) * inv;
+    b[3][3] = (a[2][0] * s3 - a[2][1] * s1 + a[2][2] * s0) * inv;
+  }
+
+  return res_;
+}
+
+template <int R, int C, typename T>
+constexpr T S21FixedMatrix<R, C, T>::Eliminate(
+    S21FixedMatrix* inverse) const {
+  // Gauss-Jordan on [A | I]; the right half ends up as inv(A).
+  S21FixedMatrix a = *this;
+  S21FixedMatrix b = Identity();
+  T det = 1;
+  for (int k = 0; k < R; ++k) {
+    int pivot = k;
+    for (int i = k + 1; i < R; ++i) {
+      T value = a.data_[i][k] < 0 ? -a.data_[i][k] : a.data_[i][k];
+      T max = a.data_[pivot][k] < 0 ? -a.data_[pivot][k] : a.data_[pivot][k];
+      if (value > max) pivot = i;
+    }
+    if (a.data_[pivot][k] == T(0)) return T(0);
+
+    if (pivot != k) {
+      // std::swap is not constexpr before C++20.
+      for (int j = 0; j < R; ++j) {
+        T row_a = a.data_[k][j], row_b = b.data_[k][j];
+        a.data_[k][j] = a.data_[pivot][j];
+        b.data_[k][j] = b.data_[pivot][j];
+        a.data_[pivot][j] = row_a;
+        b.data_[pivot][j] = row_b;
+      }
+      det = -det;
+    }
+    det *= a.data_[k][k];
+
+    T inv_pivot = T(1) / a.data_[k][k];
+    for (int j = 0; j < R; ++j) {
+      a.data_[k][j] *= inv_pivot;
+      b.data_[k][j] *= inv_pivot;
+    }
+    for (int i = 0; i < R; ++i) {
+      if (i == k) continue;
+      T l = a.data_[i][k];
+      for (int j = 0; j < R; ++j) {
+        a.data_[i][j] -= l * a.data_[k][j];
+        b.data_[i][j] -= l * b.data_[k][j];
+      }
+    }
+  }
+  if (inverse) *inverse = b;
+
+  return det;
+}
+
+template <int R, int C, typename T>
+template <int K>
+constexpr S21FixedMatrix<R, K, T> S21FixedMatrix<R, C, T>::operator*(
+    const S21FixedMatrix<C, K, T>& other) const noexcept {
+  S21FixedMatrix<R, K, T> res_;
+  S21Unroll<R>([&](auto i) {
+    S21Unroll<K>([&](auto j) {
+      T sum = 0;
+      S21Unroll<C>([&](auto k) { sum += data_[i][k] * other.data_[k][j]; });
+      res_.data_[i][j] = sum;
+    });
+  });
+
+  return res_;
+}
+
+template <int R, int C, typename T>
+constexpr S21FixedMatrix<R, C, T> S21FixedMatrix<R, C, T>::operator+(
+    const S21FixedMatrix& other) const noexcept {
+  S21FixedMatrix res_ = *this;
+  res_.SumMatrix(other);
+  return res_;
+}
+
+template <int R, int C, typename T>
+constexpr S21FixedMatrix<R, C, T> S21FixedMatrix<R, C, T>::operator-(
+    const S21FixedMatrix& other) const noexcept {
+  S21FixedMatrix res_ = *this;
+  res_.SubMatrix(other);
+  return res_;
+}
+
+template <int R, int C, typename T>
+constexpr S21FixedMatrix<R, C, T> S21FixedMatrix<R, C, T>::operator*(
+    const T num) const noexcept {
+  S21FixedMatrix res_ = *this;
+  res_.MulNumber(num);
+  return res_;
+}
+
+template <int R, int C, typename T>
+constexpr S21FixedMatrix<R, C, T>& S21FixedMatrix<R, C, T>::operator+=(
+    const S21FixedMatrix& other) noexcept {
+  SumMatrix(other);
+  return *this;
+}
+
+template <int R, int C, typename T>
+constexpr S21FixedMatrix<R, C, T>& S21FixedMatrix<R, C, T>::operator-=(
+    const S21FixedMatrix& other) noexcept {
+  SubMatrix(other);
+  return *this;
+}
+
+template <int R, int C, typename T>
+constexpr S21FixedMatrix<R, C, T>& S21FixedMatrix<R, C, T>::operator*=(
+    const S21FixedMatrix<C, C, T>& other) noexcept {
+  MulMatrix(other);
+  return *this;
+}
+
+template <int R, int C, typename T>
+constexpr S21FixedMatrix<R, C, T>& S21FixedMatrix<R, C, T>::operator*=(
+    const T num) noexcept {
+  MulNumber(num);
+  return *this;
+}
+
+template <int R, int C, typename T>
+bool S21FixedMatrix<R, C, T>::operator==(
+    const S21FixedMatrix& other) const noexcept {
+  return EqMatrix(other);
+}
+
+#endif  // CPP1_S21_MATRIXPLUS_1_S21_FIXED_MATRIX_H_
@@ -0,0 +1,220 @@
+#include "s21_gemm.h"
+
+#include <algorithm>
+#include <complex>
+#include <vector>
+
+#include "s21_thread_pool.h"
+
+namespace {
+
+constexpr int kMr = 8;
+constexpr int kNr = 4;
+constexpr int kMc = 128;
+constexpr int kKc = 256;
+constexpr int kNc = 2048;
+constexpr long kSmallProduct = 48L * 48 * 48;
+constexpr long kSerialProduct = 128L * 128 * 128;
+constexpr int kMinTile = 64;
+
+// Operands are read through a row step and a column step, so a transposed
+// operand costs nothing more than swapping them.
+template <typename T>
+struct Operand {
+  const T* data;
+  int row_step, col_step;
+
+  Operand(const T* d, int ld, bool trans)
+      : data(d), row_step(trans ? 1 : ld), col_step(trans ? ld : 1) {}
+  T operator()(int i, int j) const {
+    return data[static_cast<long>(i) * row_step +
+                static_cast<long>(j) * col_step];
+  }
+  Operand Offset(int i, int j) const {
+    Operand res = *this;
+    res.data = &data[static_cast<long>(i) * row_step +
+                     static_cast<long>(j) * col_step];
+    return res;
+  }
+};
+
+template <typename T>
+void PackA(int mc, int kc, T alpha, const Operand<T>& a, T* packed) {
+  for (int i = 0; i < mc; i += kMr) {
+    int mr = std::min(kMr, mc - i);
+    for (int p = 0; p < kc; ++p) {
+      for (int r = 0; r < mr; ++r) *packed++ = alpha * a(i + r, p);
+      for (int r = mr; r < kMr; ++r) *packed++ = T(0);
+    }
+  }
+}
+
+template <typename T>
+void PackB(int kc, int nc, const Operand<T>& b, T* packed) {
+  for (int j = 0; j < nc; j += kNr) {
+    int nr = std::min(kNr, nc - j);
+    for (int p = 0; p < kc; ++p) {
+      for (int r = 0; r < nr; ++r) *packed++ = b(p, j + r);
+      for (int r = nr; r < kNr; ++r) *packed++ = T(0);
+    }
+  }
+}
+
+template <typename T>
+void MicroKernel(int kc, const T* __restrict a, const T* __restrict b, T* c,
+                 int ldc, int mr, int nr) {
+  T ab[kMr][kNr] = {};
+  for (int p = 0; p < kc; ++p) {
+    for (int i = 0; i < kMr; ++i) {
+      for (int j = 0; j < kNr; ++j) ab[i][j] += a[i] * b[j];
+    }
+    a += kMr;
+    b += kNr;
+  }
+
+  for (int i = 0; i < mr; ++i) {
+    for (int j = 0; j < nr; ++j) c[static_cast<long>(i) * ldc + j] += ab[i][j];
+  }
+}
+
+template <typename T>
+void SmallGemm(int m, int n, int k, T alpha, const Operand<T>& a,
+               const Operand<T>& b, T* c, int ldc) {
+  for (int i = 0; i < m; ++i) {
+    T* c_row = c + static_cast<long>(i) * ldc;
+    if (b.col_step == 1) {
+      for (int p = 0; p < k; ++p) {
+        T a_ip = alpha * a(i, p);
+        const T* b_row = &b.data[static_cast<long>(p) * b.row_step];
+        for (int j = 0; j < n; ++j) c_row[j] += a_ip * b_row[j];
+      }
+    } else {
+      // Columns of a transposed B are contiguous: take dot products.
+      for (int j = 0; j < n; ++j) {
+        const T* b_col = &b.data[static_cast<long>(j) * b.col_step];
+        T sum = T(0);
+        for (int p = 0; p < k; ++p) sum += a(i, p) * b_col[p];
+        c_row[j] += alpha * sum;
+      }
+    }
+  }
+}
+
+template <typename T>
+void BlockedGemm(int m, int n, int k, T alpha, const Operand<T>& a,
+                 const Operand<T>& b, T* c, int ldc) {
+  std::vector<T> packed_a(
+      static_cast<size_t>((std::min(m, kMc) + kMr - 1) / kMr * kMr) * kKc);
+  std::vector<T> packed_b(
+      static_cast<size_t>((std::min(n, kNc) + kNr - 1) / kNr * kNr) * kKc);
+
+  for (int jc = 0; jc < n; jc += kNc) {
+    int nc = std::min(kNc, n - jc);
+    for (int pc = 0; pc < k; pc += kKc) {
+      int kc = std::min(kKc, k - pc);
+      PackB(kc, nc, b.Offset(pc, jc), packed_b.data());
+      for (int ic = 0; ic < m; ic += kMc) {
+        int mc = std::min(kMc, m - ic);
+        PackA(mc, kc, alpha, a.Offset(ic, pc), packed_a.data());
+        for (int jr = 0; jr < nc; jr += kNr) {
+          for (int ir = 0; ir < mc; ir += kMr) {
+            MicroKernel(kc, packed_a.data() + ir * kc,
+                        packed_b.data() + jr * kc,
+                        c + static_cast<long>(ic + ir) * ldc + jc + jr, ldc,
+                        std::min(kMr, mc - ir), std::min(kNr, nc - jr));
+          }
+        }
+      }
+    }
+  }
+}
+
+int TileSize(int extent, int parts, int multiple) {
+  int tile = (extent + parts - 1) / parts;
+  tile = (tile + multiple - 1) / multiple * multiple;
+  return std::max(tile, kMinTile);
+}
+
+}  // namespace
+
+template <typename T>
+void S21Gemm(bool trans_a, bool trans_b, int m, int n, int k, T alpha,
+             const T* a, int lda, const T* b, int ldb, T beta, T* c,
+             int ldc) {
+  if (m < 1 || n < 1) return;
+
+  if (beta != T(1)) {
+    for (int i = 0; i < m; ++i) {
+      T* c_row = c + static_cast<long>(i) * ldc;
+      if (beta == T(0)) {
+        std::fill(c_row, c_row + n, T(0));
+      } else {
+        for (int j = 0; j < n; ++j) c_row[j] *= beta;
+      }
+    }
+  }
+  if (k < 1 || alpha == T(0)) return;
+
+  Operand<T> op_a(a, lda, trans_a), op_b(b, ldb, trans_b);
+  long product = static_cast<long>(m) * n * k;
+  if (product <= kSmallProduct) {
+    SmallGemm(m, n, k, alpha, op_a, op_b, c, ldc);
+    return;
+  }
+
+  S21ThreadPool& pool = S21ThreadPool::Instance();
+  int threads = pool.GetThreadCount();
+  if (threads < 2 || product < kSerialProduct) {
+    BlockedGemm(m, n, k, alpha, op_a, op_b, c, ldc);
+    return;
+  }
+
+  // Split C into a grid of about two tiles per thread, cutting the longer
+  // side more often so tiles stay close to square.
+  int tiles = 2 * threads;
+  int row_parts = 1;
+  while (row_parts * row_parts * n < tiles * m && row_parts < tiles) {
+    ++row_parts;
+  }
+  int col_parts = (tiles + row_parts - 1) / row_parts;
+  int tile_m = TileSize(m, row_parts, kMr);
+  int tile_n = TileSize(n, col_parts, kNr);
+  row_parts = (m + tile_m - 1) / tile_m;
+  col_parts = (n + tile_n - 1) / tile_n;
+
+  pool.ParallelFor(row_parts * col_parts, [&](int task) {
+    int i0 = task / col_parts * tile_m;
+    int j0 = task % col_parts * tile_n;
+    BlockedGemm(std::min(tile_m, m - i0), std::min(tile_n, n - j0), k, alpha,
+                op_a.Offset(i0, 0), op_b.Offset(0, j0),
+                c + static_cast<long>(i0) * ldc + j0, ldc);
+  });
+}
+
+template <typename T>
+void S21Gemm(int m, int n, int k, const T* a, int lda, const T* b, int ldb,
+             T* c, int ldc) {
+  S21Gemm(false, false, m, n, k, T(1), a, lda, b, ldb, T(1), c, ldc);
+}
+
+template void S21Gemm(int, int, int, const float*, int, const float*, int,
+                      float*, int);
+template void S21Gemm(int, int, int, const double*, int, const double*, int,
+                      double*, int);
+template void S21Gemm(int, int, int, const long double*, int,
+                      const long double*, int, long double*, int);
+template void S21Gemm(int, int, int, const std::complex<double>*, int,
+                      const std::complex<double>*, int, std::complex<double>*,
+                      int);
+
+template void S21Gemm(bool, bool, int, int, int, float, const float*, int,
+                      const float*, int, float, float*, int);
+template void S21Gemm(bool, bool, int, int, int, double, const double*, int,
+                      const double*, int, double, double*, int);
+template void S21Gemm(bool, bool, int, int, int, long double,
+                      const long double*, int, const long double*, int,
+                      long double, long double*, int);
+template void S21Gemm(bool, bool, int, int, int, std::complex<double>,
+                      const std::complex<double>*, int,
+                      const std::complex<double>*, int, std::complex<double>,
+                      std::complex<double>*, int);
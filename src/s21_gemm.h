@@ -0,0 +1,21 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_S21_GEMM_H_
+#define CPP1_S21_MATRIXPLUS_1_S21_GEMM_H_
+
+// C(m x n) += A(m x k) * B(k x n) for row-major operands with leading
+// dimensions lda, ldb and ldc. Large products go through packed panels and
+// a register-tiled micro-kernel, small ones through a plain i-k-j loop.
+// Products above a size threshold are split into 2D tiles of C and run on
+// S21ThreadPool. Instantiated for the S21MatrixT element types.
+template <typename T>
+void S21Gemm(int m, int n, int k, const T* a, int lda, const T* b, int ldb,
+             T* c, int ldc);
+
+// C(m x n) = alpha * op(A) * op(B) + beta * C, the BLAS form of the above.
+// op(A) is m x k: A itself, or with trans_a the transpose of the k x m
+// matrix stored at a, read in place. Likewise op(B) is k x n. A beta of 0
+// overwrites C without reading it.
+template <typename T>
+void S21Gemm(bool trans_a, bool trans_b, int m, int n, int k, T alpha,
+             const T* a, int lda, const T* b, int ldb, T beta, T* c, int ldc);
+
+#endif  // CPP1_S21_MATRIXPLUS_1_S21_GEMM_H_
@@ -0,0 +1,311 @@
+#include "s21_lu.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <stdexcept>
+
+template <typename T>
+int S21LuDecompose(T* a, int n, int lda, int* pivots) {
+  using Real = typename S21ScalarTraits<T>::real_type;
+  int sign = 1;
+  for (int k = 0; k < n; ++k) {
+    int pivot = k;
+    Real max = std::abs(a[static_cast<long>(k) * lda + k]);
+    for (int i = k + 1; i < n; ++i) {
+      Real value = std::abs(a[static_cast<long>(i) * lda + k]);
+      if (value > max) {
+        max = value;
+        pivot = i;
+      }
+    }
+
+    pivots[k] = pivot;
+    if (max == Real(0)) {
+      for (int i = k + 1; i < n; ++i) pivots[i] = i;
+      return 0;
+    }
+
+    T* row_k = a + static_cast<long>(k) * lda;
+    if (pivot != k) {
+      std::swap_ranges(row_k, row_k + n, a + static_cast<long>(pivot) * lda);
+      sign = -sign;
+    }
+
+    T inv_pivot = T(1) / row_k[k];
+    for (int i = k + 1; i < n; ++i) {
+      T* row_i = a + static_cast<long>(i) * lda;
+      T l = row_i[k] * inv_pivot;
+      row_i[k] = l;
+      for (int j = k + 1; j < n; ++j) row_i[j] -= l * row_k[j];
+    }
+  }
+
+  return sign;
+}
+
+template <typename T>
+void S21LuSolve(const T* lu, int n, int lda, const int* pivots, T* b,
+                int nrhs, int ldb) {
+  for (int i = 0; i < n; ++i) {
+    if (pivots[i] != i) {
+      T* row_i = b + static_cast<long>(i) * ldb;
+      std::swap_ranges(row_i, row_i + nrhs,
+                       b + static_cast<long>(pivots[i]) * ldb);
+    }
+  }
+
+  for (int i = 1; i < n; ++i) {
+    const T* lu_row = lu + static_cast<long>(i) * lda;
+    T* row_i = b + static_cast<long>(i) * ldb;
+    for (int k = 0; k < i; ++k) {
+      T l = lu_row[k];
+      const T* row_k = b + static_cast<long>(k) * ldb;
+      for (int j = 0; j < nrhs; ++j) row_i[j] -= l * row_k[j];
+    }
+  }
+
+  for (int i = n - 1; i >= 0; --i) {
+    const T* lu_row = lu + static_cast<long>(i) * lda;
+    T* row_i = b + static_cast<long>(i) * ldb;
+    for (int k = i + 1; k < n; ++k) {
+      T u = lu_row[k];
+      const T* row_k = b + static_cast<long>(k) * ldb;
+      for (int j = 0; j < nrhs; ++j) row_i[j] -= u * row_k[j];
+    }
+    T inv_diag = T(1) / lu_row[i];
+    for (int j = 0; j < nrhs; ++j) row_i[j] *= inv_diag;
+  }
+}
+
+template <typename T>
+void S21Cofactors(const T* a, int n, int lda, T* c, int ldc) {
+  using Real = typename S21ScalarTraits<T>::real_type;
+  // Leading dimension of the packed copies, in long so row offsets of
+  // large matrices do not overflow.
+  const long ld = n;
+  std::vector<T> lu(static_cast<size_t>(n) * n);
+  for (int i = 0; i < n; ++i) {
+    const T* row = a + static_cast<long>(i) * lda;
+    std::copy(row, row + n, &lu[i * ld]);
+  }
+
+  std::vector<int> row_pivots(n), col_pivots(n);
+  T sign = 1;
+  int rank = n;
+  for (int k = 0; k < n; ++k) {
+    int pivot_row = k, pivot_col = k;
+    Real max = 0;
+    for (int i = k; i < n; ++i) {
+      for (int j = k; j < n; ++j) {
+        Real value = std::abs(lu[i * ld + j]);
+        if (value > max) {
+          max = value;
+          pivot_row = i;
+          pivot_col = j;
+        }
+      }
+    }
+
+    row_pivots[k] = pivot_row;
+    col_pivots[k] = pivot_col;
+    if (pivot_row != k) {
+      std::swap_ranges(&lu[k * ld], &lu[k * ld] + n, &lu[pivot_row * ld]);
+      sign = -sign;
+    }
+    if (pivot_col != k) {
+      for (int i = 0; i < n; ++i) {
+        std::swap(lu[i * ld + k], lu[i * ld + pivot_col]);
+      }
+      sign = -sign;
+    }
+
+    if (max <= n * std::numeric_limits<Real>::epsilon() * std::abs(lu[0])) {
+      rank = k;
+      for (int i = k + 1; i < n; ++i) row_pivots[i] = col_pivots[i] = i;
+      break;
+    }
+
+    for (int i = k + 1; i < n; ++i) {
+      T l = lu[i * ld + k] / lu[k * ld + k];
+      lu[i * ld + k] = l;
+      for (int j = k + 1; j < n; ++j) lu[i * ld + j] -= l * lu[k * ld + j];
+    }
+  }
+
+  for (int i = 0; i < n; ++i) {
+    T* c_row = c + static_cast<long>(i) * ldc;
+    std::fill(c_row, c_row + n, T(0));
+  }
+  if (rank < n - 1) return;
+
+  if (rank == n) {
+    std::vector<T> inv(static_cast<size_t>(n) * n);
+    for (int i = 0; i < n; ++i) inv[i * ld + i] = 1;
+    S21LuSolve(lu.data(), n, n, row_pivots.data(), inv.data(), n, n);
+    for (int k = n - 1; k >= 0; --k) {
+      if (col_pivots[k] != k) {
+        std::swap_ranges(&inv[k * ld], &inv[k * ld] + n,
+                         &inv[col_pivots[k] * ld]);
+      }
+    }
+
+    T det = sign;
+    for (int k = 0; k < n; ++k) det *= lu[k * ld + k];
+    for (int i = 0; i < n; ++i) {
+      T* c_row = c + static_cast<long>(i) * ldc;
+      for (int j = 0; j < n; ++j) c_row[j] = det * inv[j * ld + i];
+    }
+    return;
+  }
+
+  // Rank n - 1: adj(U) = det(U11) * x * e_n^T with U * x = 0, so
+  // adj(A) = sign * det(U11) * (Q * x) * (e_n^T * inv(L) * P).
+  std::vector<T> x(n), z(n);
+  x[n - 1] = 1;
+  for (int i = n - 2; i >= 0; --i) {
+    T sum = -lu[i * ld + n - 1];
+    for (int j = i + 1; j < n - 1; ++j) sum -= lu[i * ld + j] * x[j];
+    x[i] = sum / lu[i * ld + i];
+  }
+  z[n - 1] = 1;
+  for (int i = n - 2; i >= 0; --i) {
+    T sum = -lu[(n - 1) * ld + i];
+    for (int j = i + 1; j < n - 1; ++j) sum -= lu[j * ld + i] * z[j];
+    z[i] = sum;
+  }
+  for (int k = n - 1; k >= 0; --k) {
+    std::swap(x[k], x[col_pivots[k]]);
+    std::swap(z[k], z[row_pivots[k]]);
+  }
+
+  T scale = sign;
+  for (int k = 0; k < n - 1; ++k) scale *= lu[k * ld + k];
+  for (int i = 0; i < n; ++i) {
+    T* c_row = c + static_cast<long>(i) * ldc;
+    for (int j = 0; j < n; ++j) c_row[j] = scale * z[i] * x[j];
+  }
+}
+
+template <typename T>
+S21LUT<T>::S21LUT(const S21MatrixT<T>& matrix)
+    : S21LUT(S21MatrixViewT<T>(matrix)) {}
+
+template <typename T>
+S21LUT<T>::S21LUT(const S21MatrixViewT<T>& matrix)
+    : lu_(matrix), pivots_(matrix.GetRows()), sign_(1) {
+  if (matrix.GetRows() != matrix.GetCols())
+    throw std::logic_error("Matrix must be square");
+
+  sign_ = S21LuDecompose(lu_.matrix_, lu_.rows_, lu_.stride_, pivots_.data());
+}
+
+template <typename T>
+int S21LUT<T>::GetSize() const noexcept {
+  return lu_.rows_;
+}
+
+template <typename T>
+bool S21LUT<T>::IsSingular() const noexcept {
+  using Real = typename S21ScalarTraits<T>::real_type;
+  return LogAbsDeterminant().log_abs <= std::log(Real(1e-6));
+}
+
+template <typename T>
+T S21LUT<T>::Determinant() const noexcept {
+  T det_ = T(sign_);
+  for (int i = 0; i < lu_.rows_; ++i) det_ *= lu_.Get(i, i);
+
+  return det_;
+}
+
+template <typename T>
+S21LogDeterminant<T> S21LUT<T>::LogAbsDeterminant() const noexcept {
+  using Real = typename S21ScalarTraits<T>::real_type;
+  S21LogDeterminant<T> res_{T(sign_), 0};
+  for (int i = 0; i < lu_.rows_ && sign_ != 0; ++i) {
+    T pivot = lu_.Get(i, i);
+    Real abs = std::abs(pivot);
+    if (abs == 0) {
+      res_.sign = 0;
+      break;
+    }
+    res_.sign *= pivot / abs;
+    res_.log_abs += std::log(abs);
+  }
+  if (res_.sign == T(0)) res_.log_abs = -std::numeric_limits<Real>::infinity();
+
+  return res_;
+}
+
+template <typename T>
+std::vector<T> S21LUT<T>::Solve(const std::vector<T>& b) const {
+  if (static_cast<int>(b.size()) != lu_.rows_)
+    throw std::logic_error("Right-hand side must match the matrix size");
+
+  CheckSingular();
+  std::vector<T> x_(b);
+  S21LuSolve(lu_.matrix_, lu_.rows_, lu_.stride_, pivots_.data(), x_.data(),
+             1, 1);
+
+  return x_;
+}
+
+template <typename T>
+S21MatrixT<T> S21LUT<T>::Solve(const S21MatrixT<T>& b) const {
+  if (b.rows_ != lu_.rows_)
+    throw std::logic_error("Right-hand side must match the matrix size");
+
+  CheckSingular();
+  S21MatrixT<T> x_(b);
+  S21LuSolve(lu_.matrix_, lu_.rows_, lu_.stride_, pivots_.data(), x_.matrix_,
+             x_.cols_, x_.stride_);
+
+  return x_;
+}
+
+template <typename T>
+S21MatrixT<T> S21LUT<T>::Inverse() const {
+  CheckSingular();
+  S21MatrixT<T> res_(lu_.rows_, lu_.cols_);
+  for (int i = 0; i < res_.rows_; ++i) res_.Get(i, i) = 1;
+  S21LuSolve(lu_.matrix_, lu_.rows_, lu_.stride_, pivots_.data(),
+             res_.matrix_, res_.cols_, res_.stride_);
+
+  return res_;
+}
+
+template <typename T>
+void S21LUT<T>::CheckSingular() const {
+  if (lu_.rows_ < 1) throw std::logic_error("Matrix must be non-zero");
+
+  if (IsSingular())
+    throw std::logic_error(
+        "The determinant of the matrix cannot be equal to zero");
+}
+
+template class S21LUT<float>;
+template class S21LUT<double>;
+template class S21LUT<long double>;
+template class S21LUT<std::complex<double>>;
+
+template int S21LuDecompose(float*, int, int, int*);
+template int S21LuDecompose(double*, int, int, int*);
+template int S21LuDecompose(long double*, int, int, int*);
+template int S21LuDecompose(std::complex<double>*, int, int, int*);
+
+template void S21LuSolve(const float*, int, int, const int*, float*, int,
+                         int);
+template void S21LuSolve(const double*, int, int, const int*, double*, int,
+                         int);
+template void S21LuSolve(const long double*, int, int, const int*,
+                         long double*, int, int);
+template void S21LuSolve(const std::complex<double>*, int, int, const int*,
+                         std::complex<double>*, int, int);
+
+template void S21Cofactors(const float*, int, int, float*, int);
+template void S21Cofactors(const double*, int, int, double*, int);
+template void S21Cofactors(const long double*, int, int, long double*, int);
+template void S21Cofactors(const std::complex<double>*, int, int,
+                           std::complex<double>*, int);
@@ -0,0 +1,56 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_S21_LU_H_
+#define CPP1_S21_MATRIXPLUS_1_S21_LU_H_
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// Partial-pivot LU factorization P * A = L * U of a square matrix, computed
+// once and reused for determinants, solves and the inverse.
+template <typename T>
+class S21LUT {
+ public:
+  explicit S21LUT(const S21MatrixT<T>& matrix);
+  explicit S21LUT(const S21MatrixViewT<T>& matrix);
+
+  int GetSize() const noexcept;
+  // True when |det| <= 1e-6, judged on the log so that a long product of
+  // pivots cannot underflow to a false zero.
+  bool IsSingular() const noexcept;
+  T Determinant() const noexcept;
+  S21LogDeterminant<T> LogAbsDeterminant() const noexcept;
+  std::vector<T> Solve(const std::vector<T>& b) const;
+  S21MatrixT<T> Solve(const S21MatrixT<T>& b) const;
+  S21MatrixT<T> Inverse() const;
+
+ private:
+  void CheckSingular() const;
+
+  S21MatrixT<T> lu_;
+  std::vector<int> pivots_;
+  int sign_;
+};
+
+using S21LU = S21LUT<double>;
+
+// Factorizes the n x n row-major matrix a in place as P * A = L * U with
+// partial pivoting. On return a holds the unit lower L below the diagonal and
+// U on and above it, and row i was swapped with row pivots[i] at step i.
+// Returns the sign of P, or 0 when an exactly zero pivot stops elimination.
+template <typename T>
+int S21LuDecompose(T* a, int n, int lda, int* pivots);
+
+// Overwrites the n x nrhs row-major matrix b with the solution X of
+// A * X = B, given the output of S21LuDecompose.
+template <typename T>
+void S21LuSolve(const T* lu, int n, int lda, const int* pivots, T* b,
+                int nrhs, int ldb);
+
+// Writes the cofactor matrix of the n x n row-major matrix a to c in O(n^3).
+// Uses a complete-pivot LU: nonsingular inputs get det(A) * inv(A)^T, inputs
+// of rank n - 1 get the rank-one adjugate built from the null vectors of U
+// and L, and inputs of lower rank get zeros.
+template <typename T>
+void S21Cofactors(const T* a, int n, int lda, T* c, int ldc);
+
+#endif  // CPP1_S21_MATRIXPLUS_1_S21_LU_H_
@@ -0,0 +1,171 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_S21_MATRIX_EXPR_H_
+#define CPP1_S21_MATRIXPLUS_1_S21_MATRIX_EXPR_H_
+
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+
+#include "s21_scalar_traits.h"
+
+template <typename T>
+class S21MatrixT;
+template <typename T>
+class S21MatrixViewT;
+
+// Base of lazily evaluated element-wise matrix expressions. Every node
+// exposes value_type, GetRows(), GetCols() and an unchecked Get(i, j); an
+// S21MatrixT or an assignment to one walks the tree once per element, so a
+// chain such as A + B - 2.0 * C is computed in a single pass without
+// temporaries.
+template <typename E>
+class S21MatrixExpr {
+ public:
+  const E& Self() const noexcept { return static_cast<const E&>(*this); }
+
+  int GetRows() const noexcept { return Self().GetRows(); }
+  int GetCols() const noexcept { return Self().GetCols(); }
+  auto operator()(int i, int j) const;
+  template <typename R>
+  bool EqMatrix(const S21MatrixExpr<R>& other) const noexcept;
+  auto Eval() const;
+
+  // Read-only S21MatrixT operations, applied to the evaluated result.
+  auto Transpose() const;
+  auto CalcComplements() const;
+  auto Determinant() const;
+  auto InverseMatrix() const;
+  template <typename M>
+  auto Solve(const M& rhs) const;
+};
+
+template <typename E>
+struct S21ExprNode {
+  using type = E;
+};
+
+// Matrices are read in place through an S21MatrixViewT.
+template <typename T>
+struct S21ExprNode<S21MatrixT<T>> {
+  using type = S21MatrixViewT<T>;
+};
+
+struct S21ExprPlus {
+  template <typename T>
+  static T Apply(const T& a, const T& b) noexcept {
+    return a + b;
+  }
+};
+
+struct S21ExprMinus {
+  template <typename T>
+  static T Apply(const T& a, const T& b) noexcept {
+    return a - b;
+  }
+};
+
+template <typename L, typename R, typename Op>
+class S21MatrixBinaryExpr
+    : public S21MatrixExpr<S21MatrixBinaryExpr<L, R, Op>> {
+ public:
+  using value_type = typename L::value_type;
+  static_assert(std::is_same<value_type, typename R::value_type>::value,
+                "Matrices must have the same element type");
+
+  S21MatrixBinaryExpr(const L& lhs, const R& rhs) : lhs_(lhs), rhs_(rhs) {
+    if (lhs_.GetRows() != rhs_.GetRows() || lhs_.GetCols() != rhs_.GetCols())
+      throw std::logic_error("Matrices must be of the same dimension");
+  }
+
+  int GetRows() const noexcept { return lhs_.GetRows(); }
+  int GetCols() const noexcept { return lhs_.GetCols(); }
+  value_type Get(int i, int j) const noexcept {
+    return Op::Apply(lhs_.Get(i, j), rhs_.Get(i, j));
+  }
+
+ private:
+  L lhs_;
+  R rhs_;
+};
+
+template <typename E>
+class S21MatrixScaledExpr : public S21MatrixExpr<S21MatrixScaledExpr<E>> {
+ public:
+  using value_type = typename E::value_type;
+
+  S21MatrixScaledExpr(const E& expr, value_type num)
+      : expr_(expr), num_(num) {}
+
+  int GetRows() const noexcept { return expr_.GetRows(); }
+  int GetCols() const noexcept { return expr_.GetCols(); }
+  value_type Get(int i, int j) const noexcept {
+    return expr_.Get(i, j) * num_;
+  }
+
+ private:
+  E expr_;
+  value_type num_;
+};
+
+template <typename E>
+auto S21MatrixExpr<E>::operator()(int i, int j) const {
+  if (i >= GetRows() || j >= GetCols() || i < 0 || j < 0)
+    throw std::out_of_range("Incorrect input, index is out of range");
+
+  return typename S21ExprNode<E>::type(Self()).Get(i, j);
+}
+
+template <typename E>
+template <typename R>
+bool S21MatrixExpr<E>::EqMatrix(const S21MatrixExpr<R>& other) const noexcept {
+  if (GetRows() != other.GetRows() || GetCols() != other.GetCols())
+    return false;
+
+  typename S21ExprNode<E>::type lhs(Self());
+  typename S21ExprNode<R>::type rhs(other.Self());
+  auto eps = S21MatrixT<typename E::value_type>::GetEqTolerance();
+  for (int i = 0; i < lhs.GetRows(); ++i) {
+    for (int j = 0; j < lhs.GetCols(); ++j) {
+      if (std::abs(lhs.Get(i, j) - rhs.Get(i, j)) > eps) return false;
+    }
+  }
+
+  return true;
+}
+
+template <typename L, typename R>
+S21MatrixBinaryExpr<typename S21ExprNode<L>::type,
+                    typename S21ExprNode<R>::type, S21ExprPlus>
+operator+(const S21MatrixExpr<L>& lhs, const S21MatrixExpr<R>& rhs) {
+  return {lhs.Self(), rhs.Self()};
+}
+
+template <typename L, typename R>
+S21MatrixBinaryExpr<typename S21ExprNode<L>::type,
+                    typename S21ExprNode<R>::type, S21ExprMinus>
+operator-(const S21MatrixExpr<L>& lhs, const S21MatrixExpr<R>& rhs) {
+  return {lhs.Self(), rhs.Self()};
+}
+
+// The scalar takes the element type of the expression, so 2.0 scales a
+// float or complex matrix without a deduction conflict.
+template <typename E>
+S21MatrixScaledExpr<typename S21ExprNode<E>::type> operator*(
+    const S21MatrixExpr<E>& expr,
+    const typename S21ExprNode<E>::type::value_type num) {
+  return {expr.Self(), num};
+}
+
+template <typename E>
+S21MatrixScaledExpr<typename S21ExprNode<E>::type> operator*(
+    const typename S21ExprNode<E>::type::value_type num,
+    const S21MatrixExpr<E>& expr) {
+  return {expr.Self(), num};
+}
+
+template <typename L, typename R>
+bool operator==(const S21MatrixExpr<L>& lhs,
+                const S21MatrixExpr<R>& rhs) noexcept {
+  return lhs.EqMatrix(rhs);
+}
+
+#endif  // CPP1_S21_MATRIXPLUS_1_S21_MATRIX_EXPR_H_
@@ -1,317 +1,476 @@
 #include "s21_matrix_oop.h"
 
+#include <algorithm>
+#include <cmath>
+#include <complex>
 #include <cstring>
 #include <iostream>
 
-S21Matrix::S21Matrix() : rows_(0), cols_(0), matrix_(nullptr) {}
+#include "s21_lu.h"
+#include "s21_matrix_pool.h"
+#include "s21_simd.h"
+#include "s21_transpose.h"
 
-S21Matrix::S21Matrix(int rows, int cols) : rows_(rows), cols_(cols) {
+namespace {
+
+constexpr int kLineBytes = 64;
+constexpr int kAliasBytes = 1024;
+
+// Runs a contiguous kernel over matching rows of two matrices of the same
+// size, in one call when neither of them has row padding.
+template <typename T>
+void ForEachRow(void (*kernel)(T*, const T*, long), S21MatrixT<T>& dst,
+                const S21MatrixT<T>& src) {
+  int rows = dst.GetRows(), cols = dst.GetCols();
+  if (dst.GetStride() == cols && src.GetStride() == cols) {
+    kernel(dst.Data(), src.Data(), static_cast<long>(rows) * cols);
+  } else {
+    for (int i = 0; i < rows; ++i) kernel(dst.RowPtr(i), src.RowPtr(i), cols);
+  }
+}
+
+}  // namespace
+
+template <typename T>
+S21MatrixT<T>::S21MatrixT()
+    : rows_(0), cols_(0), stride_(0), capacity_(0), matrix_(nullptr) {}
+
+template <typename T>
+S21MatrixT<T>::S21MatrixT(int rows, int cols) : rows_(rows), cols_(cols) {
   if (rows_ < 1 || cols_ < 1)
     throw std::invalid_argument(
         "Incorrect input, matrix should have positive size");
 
-  matrix_ = new double[rows_ * cols_]();
+  stride_ = LeadingDimension(cols_);
+  capacity_ = rows_;
+  matrix_ = Allocate(rows_, stride_);
+  std::fill(matrix_, matrix_ + static_cast<long>(rows_) * stride_, T(0));
 }
 
-S21Matrix::S21Matrix(const S21Matrix& other)
-    : rows_(other.rows_),
-      cols_(other.cols_),
-      matrix_(new double[rows_ * cols_]()) {
-  std::copy(other.matrix_, other.matrix_ + rows_ * cols_, matrix_);
-}
+template <typename T>
+S21MatrixT<T>::S21MatrixT(int rows, int cols, Uninitialized)
+    : rows_(rows),
+      cols_(cols),
+      stride_(LeadingDimension(cols_)),
+      capacity_(rows_),
+      matrix_(Allocate(rows_, stride_)) {}
 
-S21Matrix::S21Matrix(S21Matrix&& other) noexcept
+template <typename T>
+S21MatrixT<T>::S21MatrixT(const S21MatrixT& other)
     : rows_(other.rows_),
       cols_(other.cols_),
-      matrix_(new double[rows_ * cols_]()) {
-  std::copy(other.matrix_, other.matrix_ + rows_ * cols_, matrix_);
+      stride_(LeadingDimension(cols_)),
+      capacity_(rows_),
+      matrix_(Allocate(rows_, stride_)) {
+  for (int i = 0; i < rows_; ++i) {
+    std::copy(other.RowPtr(i), other.RowPtr(i) + cols_, RowPtr(i));
+  }
+}
 
-  other.rows_ = 0;
-  other.cols_ = 0;
-  delete[] other.matrix_;
-  other.matrix_ = nullptr;
+template <typename T>
+S21MatrixT<T>::S21MatrixT(S21MatrixT&& other) noexcept : matrix_(nullptr) {
+  Steal(other);
 }
 
-S21Matrix::~S21Matrix() {
+template <typename T>
+S21MatrixT<T>::~S21MatrixT() {
   rows_ = 0;
   cols_ = 0;
-  delete[] matrix_;
+  stride_ = 0;
+  capacity_ = 0;
+  Release(matrix_);
   matrix_ = nullptr;
 }
 
-int S21Matrix::GetRows() const noexcept { return rows_; }
+template <typename T>
+int S21MatrixT<T>::LeadingDimension(int cols) noexcept {
+  constexpr int line = static_cast<int>(kLineBytes / sizeof(T));
+  constexpr int alias = static_cast<int>(kAliasBytes / sizeof(T));
+  if (cols < line) return cols;
 
-int S21Matrix::GetCols() const noexcept { return cols_; }
+  int stride = (cols + line - 1) / line * line;
+  if (stride % alias == 0) stride += line;
 
-void S21Matrix::SetRows(int new_rows_) {
-  if (new_rows_ < 0)
-    throw std::invalid_argument(
-        "Incorrect input, matrix should have positive size");
+  return stride;
+}
+
+template <typename T>
+T* S21MatrixT<T>::Allocate(int rows, int stride) {
+  long count = static_cast<long>(rows) * stride;
+  if (count <= 0) return nullptr;
+  if (count <= kInlineElements) return Inline();
+
+  return static_cast<T*>(S21MatrixPool::Local().Allocate(count * sizeof(T)));
+}
+
+template <typename T>
+T* S21MatrixT<T>::AllocateReplacement(int rows, int stride) {
+  long count = static_cast<long>(rows) * stride;
+  if (count <= 0) return nullptr;
+  if (count <= kInlineElements) return Inline();
+
+  const T* replaced = IsInline() ? nullptr : matrix_;
+  return static_cast<T*>(
+      S21MatrixPool::Local().Allocate(count * sizeof(T), replaced));
+}
+
+template <typename T>
+void S21MatrixT<T>::Release(T* data) noexcept {
+  if (data != Inline()) S21MatrixPool::Release(data);
+}
+
+template <typename T>
+T* S21MatrixT<T>::Inline() noexcept {
+  return reinterpret_cast<T*>(inline_);
+}
 
-  S21Matrix tmp_(new_rows_, cols_);
-  int tmp_rows_ = 0;
-  if (new_rows_ > rows_) {
-    tmp_rows_ = rows_;
+template <typename T>
+bool S21MatrixT<T>::IsInline() const noexcept {
+  return matrix_ == reinterpret_cast<const T*>(inline_);
+}
+
+template <typename T>
+const S21MatrixArena* S21MatrixT<T>::Arena() const noexcept {
+  if (!matrix_ || IsInline()) return nullptr;
+
+  return S21MatrixPool::ArenaOf(matrix_);
+}
+
+template <typename T>
+void S21MatrixT<T>::Steal(S21MatrixT& other) noexcept {
+  rows_ = other.rows_;
+  cols_ = other.cols_;
+  stride_ = other.stride_;
+  capacity_ = other.capacity_;
+  if (other.IsInline()) {
+    matrix_ = Inline();
+    std::copy(other.matrix_,
+              other.matrix_ + static_cast<long>(capacity_) * stride_, matrix_);
   } else {
-    tmp_rows_ = new_rows_;
+    matrix_ = other.matrix_;
   }
 
-  for (int i = 0; i < tmp_rows_; ++i) {
-    for (int j = 0; j < cols_; ++j) {
-      tmp_(i, j) = (*this)(i, j);
-    }
+  other.rows_ = 0;
+  other.cols_ = 0;
+  other.stride_ = 0;
+  other.capacity_ = 0;
+  other.matrix_ = nullptr;
+}
+
+template <typename T>
+T* S21MatrixT<T>::Reallocate(int capacity, int stride) {
+  // Restriding inside the inline buffer would overwrite rows before they
+  // move, so those are read from a copy.
+  alignas(64) unsigned char saved[kInlineBytes];
+  const T* old = matrix_;
+  T* matrix = AllocateReplacement(capacity, stride);
+  if (matrix == matrix_) {
+    std::memcpy(saved, inline_, kInlineBytes);
+    old = reinterpret_cast<const T*>(saved);
   }
+  for (int i = 0; i < rows_; ++i) {
+    const T* row = old + static_cast<long>(i) * stride_;
+    std::copy(row, row + cols_, matrix + static_cast<long>(i) * stride);
+  }
+  std::swap(matrix, matrix_);
+  stride_ = stride;
+  capacity_ = capacity;
+
+  return matrix;
+}
 
-  *this = std::move(tmp_);
+template <typename T>
+int S21MatrixT<T>::GetRows() const noexcept {
+  return rows_;
 }
 
-void S21Matrix::SetCols(int new_cols_) {
-  if (new_cols_ < 0)
+template <typename T>
+int S21MatrixT<T>::GetCols() const noexcept {
+  return cols_;
+}
+
+template <typename T>
+void S21MatrixT<T>::SetRows(int new_rows_) {
+  if (new_rows_ < 1 || cols_ < 1)
     throw std::invalid_argument(
         "Incorrect input, matrix should have positive size");
 
-  S21Matrix tmp_(rows_, new_cols_);
-  int tmp_cols_ = 0;
-  if (new_cols_ > cols_) {
-    tmp_cols_ = cols_;
-  } else {
-    tmp_cols_ = new_cols_;
+  if (new_rows_ > capacity_)
+    Release(Reallocate(std::max(new_rows_, 2 * capacity_), stride_));
+  for (int i = rows_; i < new_rows_; ++i) {
+    std::fill(RowPtr(i), RowPtr(i) + cols_, T(0));
   }
+  rows_ = new_rows_;
+}
 
-  for (int i = 0; i < rows_; ++i) {
-    for (int j = 0; j < tmp_cols_; ++j) {
-      tmp_(i, j) = (*this)(i, j);
-    }
+template <typename T>
+void S21MatrixT<T>::SetCols(int new_cols_) {
+  if (new_cols_ < 1 || rows_ < 1)
+    throw std::invalid_argument(
+        "Incorrect input, matrix should have positive size");
+
+  if (new_cols_ > stride_)
+    Release(Reallocate(capacity_, LeadingDimension(new_cols_)));
+  for (int i = 0; i < rows_ && new_cols_ > cols_; ++i) {
+    std::fill(RowPtr(i) + cols_, RowPtr(i) + new_cols_, T(0));
   }
+  cols_ = new_cols_;
+}
+
+template <typename T>
+void S21MatrixT<T>::Reserve(int rows, int cols) {
+  if (rows < 0 || cols < 0)
+    throw std::invalid_argument(
+        "Incorrect input, matrix should have positive size");
+
+  if (rows_ == 0 && cols > 0) cols_ = cols;
+  if (rows <= capacity_ && cols <= stride_) return;
 
-  *this = std::move(tmp_);
+  int stride = cols > stride_ ? LeadingDimension(cols) : stride_;
+  Release(Reallocate(std::max(rows, capacity_), stride));
 }
 
-void S21Matrix::SumMatrix(const S21Matrix& other) {
-  if (rows_ != other.rows_ || cols_ != other.cols_)
-    throw std::logic_error("Matrices must be of the same dimension");
+template <typename T>
+void S21MatrixT<T>::AppendRow(const T* row) {
+  if (cols_ < 1) throw std::logic_error("Matrix must have a width to append");
 
-  for (int i = 0; i < other.rows_; ++i) {
-    for (int j = 0; j < other.cols_; ++j) {
-      (*this)(i, j) += other(i, j);
-    }
+  T* old_ = nullptr;
+  if (rows_ == capacity_) {
+    int stride = stride_ ? stride_ : LeadingDimension(cols_);
+    old_ = Reallocate(std::max(2 * capacity_, 4), stride);
   }
+  std::copy(row, row + cols_, RowPtr(rows_));
+  ++rows_;
+  Release(old_);
+}
+
+template <typename T>
+void S21MatrixT<T>::ShrinkToFit() {
+  int stride = LeadingDimension(cols_);
+  if (capacity_ != rows_ || stride_ != stride)
+    Release(Reallocate(rows_, stride));
 }
 
-void S21Matrix::SubMatrix(const S21Matrix& other) {
+template <typename T>
+void S21MatrixT<T>::SumMatrix(const S21MatrixT& other) {
   if (rows_ != other.rows_ || cols_ != other.cols_)
     throw std::logic_error("Matrices must be of the same dimension");
 
-  for (int i = 0; i < other.rows_; ++i) {
-    for (int j = 0; j < other.cols_; ++j) {
-      (*this)(i, j) -= other(i, j);
-    }
-  }
+  ForEachRow(S21Simd<T>().add, *this, other);
 }
 
-void S21Matrix::MulMatrix(const S21Matrix& other) {
-  if (cols_ != other.rows_)
-    throw std::logic_error("Inconsistency in the number of columns and rows");
+template <typename T>
+void S21MatrixT<T>::SubMatrix(const S21MatrixT& other) {
+  if (rows_ != other.rows_ || cols_ != other.cols_)
+    throw std::logic_error("Matrices must be of the same dimension");
 
-  S21Matrix res_(rows_, other.cols_);
-  for (int i = 0; i < rows_; ++i) {
-    for (int j = 0; j < other.cols_; ++j) {
-      for (int m = 0; m < cols_; ++m) {
-        res_(i, j) += (*this)(i, m) * other(m, j);
-      }
-    }
-  }
+  ForEachRow(S21Simd<T>().sub, *this, other);
+}
 
-  *this = std::move(res_);
+template <typename T>
+void S21MatrixT<T>::MulMatrix(const S21MatrixT& other) {
+  *this = *this * other;
 }
 
-void S21Matrix::MulNumber(const double num) {
-  for (int i = 0; i < rows_; ++i) {
-    for (int j = 0; j < cols_; ++j) {
-      (*this)(i, j) *= num;
-    }
+template <typename T>
+void S21MatrixT<T>::MulNumber(const T num) {
+  const S21SimdKernelsT<T>& simd = S21Simd<T>();
+  if (stride_ == cols_) {
+    simd.scale(matrix_, num, static_cast<long>(rows_) * cols_);
+  } else {
+    for (int i = 0; i < rows_; ++i) simd.scale(RowPtr(i), num, cols_);
   }
 }
 
-bool S21Matrix::EqMatrix(const S21Matrix& other) const noexcept {
+template <typename T>
+bool S21MatrixT<T>::EqMatrix(const S21MatrixT& other) const noexcept {
   if (rows_ != other.rows_ || cols_ != other.cols_) return false;
 
-  for (int i = 0; i < other.rows_; ++i) {
-    for (int j = 0; j < other.cols_; ++j) {
-      if (fabs((*this)(i, j) - other(i, j)) > 1e-6) {
-        return false;
-      }
-    }
+  const S21SimdKernelsT<T>& simd = S21Simd<T>();
+  if (stride_ == cols_ && other.stride_ == cols_)
+    return simd.equal(matrix_, other.matrix_, static_cast<long>(rows_) * cols_,
+                      eq_tolerance_);
+
+  for (int i = 0; i < rows_; ++i) {
+    if (!simd.equal(RowPtr(i), other.RowPtr(i), cols_, eq_tolerance_))
+      return false;
   }
 
   return true;
 }
 
-S21Matrix S21Matrix::Transpose() const noexcept {
-  S21Matrix res_(cols_, rows_);
-  for (int i = 0; i < cols_; ++i) {
-    for (int j = 0; j < rows_; ++j) {
-      res_(i, j) = (*this)(j, i);
-    }
+template <typename T>
+S21MatrixT<T> S21MatrixT<T>::Transpose() const noexcept {
+  return S21MatrixViewT<T>(*this).Transpose();
+}
+
+template <typename T>
+void S21MatrixT<T>::TransposeInPlace() {
+  if (rows_ == cols_) {
+    S21TransposeInPlace(matrix_, rows_, cols_, stride_);
+    return;
   }
 
-  return res_;
+  // The cycle walk needs a flat buffer: squeeze out the row padding first.
+  // The result stays unpadded, with its stride equal to its new width.
+  for (int i = 1; i < rows_ && stride_ != cols_; ++i) {
+    std::copy(RowPtr(i), RowPtr(i) + cols_,
+              matrix_ + static_cast<long>(i) * cols_);
+  }
+  S21TransposeInPlace(matrix_, rows_, cols_, cols_);
+  std::swap(rows_, cols_);
+  stride_ = cols_;
+  capacity_ = rows_;
 }
 
-S21Matrix S21Matrix::CalcComplements() const {
+template <typename T>
+S21MatrixT<T> S21MatrixT<T>::CalcComplements() const {
   if (rows_ != cols_) throw std::logic_error("Matrix must be square");
 
   if (rows_ < 2)
     throw std::logic_error("Matrix must be non-zero and non-unique");
 
-  int order_ = this->rows_ - 1;
-  S21Matrix tmp_(*this);
-  S21Matrix res_(this->rows_, this->cols_);
-  for (int i = 0; i < this->rows_; ++i) {
-    for (int j = 0; j < this->cols_; ++j) {
-      res_(i, j) = pow(-1, i + j) * tmp_.CalcMinor(i, j, order_);
-    }
-  }
+  S21MatrixT res_(rows_, cols_, Uninitialized());
+  S21Cofactors(matrix_, rows_, stride_, res_.matrix_, res_.stride_);
 
-  return (res_);
+  return res_;
 }
 
-double S21Matrix::Determinant() const {
-  if (rows_ != cols_) throw std::logic_error("Matrix must be square");
-
-  double res_ = 1;
-  int count_ = 0;
-  int sign_ = 0;
-  double number_ = 0;
-  S21Matrix tmp_(*this);
-  for (int j = 0; j < cols_; ++j) {
-    sign_ = tmp_.SwapRows(j);
-    for (int i = tmp_.rows_ - 1; i > count_; --i) {
-      number_ = tmp_(i, j) / tmp_(j, j);
-      for (int m = 0; m < tmp_.cols_; ++m) {
-        tmp_(i, m) -= number_ * tmp_(j, m);
-      }
-    }
-    res_ *= sign_ * tmp_(j, j);
-    ++count_;
-  }
-
-  if (fabs(res_) <= 1e-6) res_ = fabs(res_);
+template <typename T>
+T S21MatrixT<T>::Determinant() const {
+  return S21MatrixViewT<T>(*this).Determinant();
+}
 
-  return res_;
+template <typename T>
+__int128 S21MatrixT<T>::ExactDeterminant() const {
+  return S21MatrixViewT<T>(*this).ExactDeterminant();
 }
 
-S21Matrix S21Matrix::InverseMatrix() const {
-  double det_ = Determinant();
-  if (fabs(det_) <= 1e-6)
-    throw std::logic_error(
-        "The determinant of the matrix cannot be equal to zero");
+template <typename T>
+S21LogDeterminant<T> S21MatrixT<T>::LogAbsDeterminant() const {
+  return S21MatrixViewT<T>(*this).LogAbsDeterminant();
+}
 
-  S21Matrix res_ = CalcComplements().Transpose();
-  res_.MulNumber(1 / det_);
+template <typename T>
+S21MatrixT<T> S21MatrixT<T>::InverseMatrix() const {
+  if (rows_ != cols_) throw std::logic_error("Matrix must be square");
 
-  return res_;
+  return S21LUT<T>(*this).Inverse();
 }
 
-S21Matrix S21Matrix::operator+(const S21Matrix& other) const {
-  S21Matrix res_(*this);
-  res_.SumMatrix(other);
-  return res_;
-}
+template <typename T>
+S21MatrixT<T> S21MatrixT<T>::Solve(const S21MatrixT& rhs) const {
+  if (rows_ != cols_) throw std::logic_error("Matrix must be square");
 
-S21Matrix S21Matrix::operator-(const S21Matrix& other) const {
-  S21Matrix res_(*this);
-  res_.SubMatrix(other);
-  return res_;
+  return S21LUT<T>(*this).Solve(rhs);
 }
 
-S21Matrix S21Matrix::operator*(const S21Matrix& other) const {
-  S21Matrix res_(*this);
-  res_.MulMatrix(other);
-  return res_;
+template <typename T>
+S21MatrixT<T> S21MatrixT<T>::operator*(const S21MatrixT& other) const {
+  return S21Multiply<T>(*this, other);
 }
 
-S21Matrix S21Matrix::operator*(const double num) const {
-  S21Matrix res_(*this);
-  res_.MulNumber(num);
-  return res_;
+template <typename T>
+S21MatrixViewT<T> S21MatrixT<T>::Block(int row, int col, int rows,
+                                       int cols) const {
+  return S21MatrixViewT<T>(*this).Block(row, col, rows, cols);
 }
 
-S21Matrix operator*(const double num, S21Matrix& other) {
-  S21Matrix res_(other);
-  res_.MulNumber(num);
-  return res_;
+template <typename T>
+S21MatrixViewT<T> S21MatrixT<T>::RowRange(int first, int count) const {
+  return S21MatrixViewT<T>(*this).RowRange(first, count);
 }
 
-bool S21Matrix::operator==(const S21Matrix& other) const noexcept {
+template <typename T>
+bool S21MatrixT<T>::operator==(const S21MatrixT& other) const noexcept {
   return EqMatrix(other);
 }
 
-S21Matrix& S21Matrix::operator=(const S21Matrix& other) {
+template <typename T>
+S21MatrixT<T>& S21MatrixT<T>::operator=(const S21MatrixT& other) {
   if (&other != this) {
-    delete[] matrix_;
-    rows_ = other.rows_;
-    cols_ = other.cols_;
-    matrix_ = new double[rows_ * cols_]();
-    std::copy(other.matrix_, other.matrix_ + rows_ * cols_, matrix_);
+    if (rows_ != other.rows_ || cols_ != other.cols_) {
+      int stride = LeadingDimension(other.cols_);
+      T* matrix = AllocateReplacement(other.rows_, stride);
+      Release(matrix_);
+      rows_ = other.rows_;
+      cols_ = other.cols_;
+      stride_ = stride;
+      capacity_ = rows_;
+      matrix_ = matrix;
+    }
+    for (int i = 0; i < rows_; ++i) {
+      std::copy(other.RowPtr(i), other.RowPtr(i) + cols_, RowPtr(i));
+    }
   }
 
   return *this;
 }
 
-S21Matrix& S21Matrix::operator=(S21Matrix&& other) {
+template <typename T>
+S21MatrixT<T>& S21MatrixT<T>::operator=(S21MatrixT&& other) {
+  if (other.Arena() && other.Arena() != Arena()) {
+    return *this = static_cast<const S21MatrixT&>(other);
+  }
   if (&other != this) {
-    std::swap(rows_, other.rows_);
-    std::swap(cols_, other.cols_);
-    std::swap(matrix_, other.matrix_);
+    Release(matrix_);
+    Steal(other);
   }
 
   return *this;
 }
 
-S21Matrix& S21Matrix::operator+=(const S21Matrix& other) {
+template <typename T>
+S21MatrixT<T>& S21MatrixT<T>::operator+=(const S21MatrixT& other) {
   SumMatrix(other);
   return *this;
 }
 
-S21Matrix& S21Matrix::operator-=(const S21Matrix& other) {
+template <typename T>
+S21MatrixT<T>& S21MatrixT<T>::operator-=(const S21MatrixT& other) {
   SubMatrix(other);
   return *this;
 }
 
-S21Matrix& S21Matrix::operator*=(const S21Matrix& other) {
+template <typename T>
+S21MatrixT<T>& S21MatrixT<T>::operator*=(const S21MatrixT& other) {
   MulMatrix(other);
   return (*this);
 }
 
-S21Matrix& S21Matrix::operator*=(const double num) {
+template <typename T>
+S21MatrixT<T>& S21MatrixT<T>::operator*=(const T num) {
   MulNumber(num);
   return (*this);
 }
 
-double& S21Matrix::operator()(int i, int j) const {
+template <typename T>
+T& S21MatrixT<T>::operator()(int i, int j) const {
   if (i >= rows_ || j >= cols_ || i < 0 || j < 0)
     throw std::out_of_range("Incorrect input, index is out of range");
 
-  return matrix_[i * cols_ + j];
-}
-
-double S21Matrix::CalcMinor(int crossed_out_rows, int crossed_out_columns,
-                            int order) const {
-  double minor_ = 0;
-  S21Matrix minor_element_(order, order);
-  for (int n = 0, i = 0; i < this->rows_; ++i, ++n) {
-    if (i != crossed_out_rows) {
-      for (int m = 0, j = 0; j < this->cols_; ++j, ++m) {
-        if (j != crossed_out_columns) {
-          minor_element_(n, m) = (*this)(i, j);
-        } else {
-          --m;
-        }
-      }
-    } else {
-      --n;
-    }
+  return matrix_[static_cast<long>(i) * stride_ + j];
+}
+
+template <typename T>
+T S21MatrixT<T>::CalcMinor(int crossed_out_rows, int crossed_out_columns,
+                           int order) const {
+  if (rows_ != cols_) throw std::logic_error("Matrix must be square");
+
+  if (order != rows_ - 1 || crossed_out_rows < 0 ||
+      crossed_out_rows >= rows_ || crossed_out_columns < 0 ||
+      crossed_out_columns >= cols_)
+    throw std::out_of_range("Incorrect input, index is out of range");
+
+  T minor_ = 0;
+  S21MatrixT minor_element_(order, order, Uninitialized());
+  for (int n = 0, i = 0; i < this->rows_; ++i) {
+    if (i == crossed_out_rows) continue;
+    const T* src_ = RowPtr(i);
+    T* dst_ = minor_element_.RowPtr(n++);
+    std::copy(src_, src_ + crossed_out_columns, dst_);
+    std::copy(src_ + crossed_out_columns + 1, src_ + this->cols_,
+              dst_ + crossed_out_columns);
   }
 
   minor_ = minor_element_.Determinant();
@@ -319,34 +478,35 @@ double S21Matrix::CalcMinor(int crossed_out_rows, int crossed_out_columns,
   return minor_;
 }
 
-int S21Matrix::SwapRows(int m) {
+template <typename T>
+int S21MatrixT<T>::SwapRows(int m) {
   int flag_ = 1;
-  double max_ = fabs((*this)(m, m));
+  real_type max_ = std::abs((*this)(m, m));
   int max_rows_ = 0;
   for (int i = m; i < this->rows_; ++i) {
-    if (max_ < fabs((*this)(i, m))) {
-      max_ = fabs((*this)(i, m));
+    if (max_ < std::abs(Get(i, m))) {
+      max_ = std::abs(Get(i, m));
       max_rows_ = i;
       flag_ = -1;
     }
   }
 
   if (flag_ == -1) {
-    for (int j = 0; j < this->rows_; ++j) {
-      double tmp_ = (*this)(m, j);
-      (*this)(m, j) = (*this)(max_rows_, j);
-      (*this)(max_rows_, j) = tmp_;
-    }
+    std::swap_ranges(RowPtr(m), RowPtr(m) + this->rows_, RowPtr(max_rows_));
   }
 
   return flag_;
 }
 
-void S21Matrix::PrintMatrix() {
+template <typename T>
+void S21MatrixT<T>::PrintMatrix() {
   for (int i = 0; i < this->rows_; ++i) {
-    for (int j = 0; j < this->cols_; ++j) {
-      std::cout << (*this)(i, j) << "\t";
-    }
+    for (T value_ : Row(i)) std::cout << value_ << "\t";
     std::cout << std::endl;
   }
 }
+
+template class S21MatrixT<float>;
+template class S21MatrixT<double>;
+template class S21MatrixT<long double>;
+template class S21MatrixT<std::complex<double>>;
@@ -1,53 +1,405 @@
 #ifndef CPP1_S21_MATRIXPLUS_1_S21_MATRIX_OOP_H_
 #define CPP1_S21_MATRIXPLUS_1_S21_MATRIX_OOP_H_
 
-class S21Matrix {
+#include <type_traits>
+#include <utility>
+
+#include "s21_matrix_expr.h"
+#include "s21_matrix_view.h"
+#include "s21_row_view.h"
+#include "s21_scalar_traits.h"
+
+class S21MatrixArena;
+
+template <typename T>
+class S21LUT;
+
+// Dense row-major matrix of T. The library is compiled for float, double,
+// long double and std::complex<double>; S21Matrix is the double matrix.
+// Matrices of up to kInlineBytes, such as 4 x 4 doubles, keep their
+// elements inside the object instead of a pooled buffer; moving one of
+// those copies the elements, so its Data() and views do not survive a move.
+template <typename T>
+class S21MatrixT : public S21MatrixExpr<S21MatrixT<T>> {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "Matrix elements live in raw pooled storage");
+
  public:
-  S21Matrix();
-  S21Matrix(int rows, int cols);
-  S21Matrix(const S21Matrix& other);
-  S21Matrix(S21Matrix&& other) noexcept;
-  ~S21Matrix();
+  using value_type = T;
+  using real_type = typename S21ScalarTraits<T>::real_type;
+
+  S21MatrixT();
+  S21MatrixT(int rows, int cols);
+  S21MatrixT(const S21MatrixT& other);
+  S21MatrixT(S21MatrixT&& other) noexcept;
+  template <typename E>
+  S21MatrixT(const S21MatrixExpr<E>& expr);
+  ~S21MatrixT();
 
   int GetRows() const noexcept;
   int GetCols() const noexcept;
+  // Distance in elements between the starts of consecutive rows.
+  int GetStride() const noexcept;
+  // Rows that fit before the next reallocation.
+  int GetRowCapacity() const noexcept;
+  // Shrinking keeps the buffer; growing reallocates only past the capacity
+  // (rows, grown at least twofold) or the stride (columns). New elements
+  // are zero.
   void SetRows(int new_rows_);
   void SetCols(int new_cols_);
+  // Makes room for rows x cols without changing the size. An empty matrix
+  // also takes cols as its width, so rows can then be appended to it.
+  void Reserve(int rows, int cols);
+  // Copies GetCols() values from row to a new last row, doubling the row
+  // capacity when it is full. row may point into this matrix.
+  void AppendRow(const T* row);
+  // Drops spare rows and restores the default stride for the width.
+  void ShrinkToFit();
+
+  // Largest element difference EqMatrix and == still accept, shared by all
+  // matrices of T. Starts at S21ScalarTraits<T>::Tolerance(); the setting
+  // is not synchronized, so change it before comparing on other threads.
+  static real_type GetEqTolerance() noexcept;
+  static void SetEqTolerance(real_type eps) noexcept;
 
-  void SumMatrix(const S21Matrix& other);
-  void SubMatrix(const S21Matrix& other);
-  void MulMatrix(const S21Matrix& other);
-  void MulNumber(const double num);
-  bool EqMatrix(const S21Matrix& other) const noexcept;
-  S21Matrix Transpose() const noexcept;
-  S21Matrix CalcComplements() const;
-  double Determinant() const;
-  S21Matrix InverseMatrix() const;
-
-  S21Matrix operator+(const S21Matrix& other) const;
-  S21Matrix operator-(const S21Matrix& other) const;
-  S21Matrix operator*(const S21Matrix& other) const;
-  S21Matrix operator*(const double num) const;
-  bool operator==(const S21Matrix& other) const noexcept;
-  S21Matrix& operator=(const S21Matrix& other);
-  S21Matrix& operator=(S21Matrix&& other);
-  S21Matrix& operator+=(const S21Matrix& other);
-  S21Matrix& operator-=(const S21Matrix& other);
-  S21Matrix& operator*=(const S21Matrix& other);
-  S21Matrix& operator*=(const double num);
-  double& operator()(int i, int j) const;
-
-  friend S21Matrix operator*(const double num, S21Matrix& other);
+  void SumMatrix(const S21MatrixT& other);
+  void SubMatrix(const S21MatrixT& other);
+  void MulMatrix(const S21MatrixT& other);
+  void MulNumber(const T num);
+  bool EqMatrix(const S21MatrixT& other) const noexcept;
+  using S21MatrixExpr<S21MatrixT>::EqMatrix;
+  S21MatrixT Transpose() const noexcept;
+  void TransposeInPlace();
+  S21MatrixT CalcComplements() const;
+  // See S21MatrixViewT::Determinant, ExactDeterminant and
+  // LogAbsDeterminant.
+  T Determinant() const;
+  __int128 ExactDeterminant() const;
+  S21LogDeterminant<T> LogAbsDeterminant() const;
+  // Through S21LUT; S21CholeskyT does half the work for matrices known to
+  // be symmetric positive definite.
+  S21MatrixT InverseMatrix() const;
+  S21MatrixT Solve(const S21MatrixT& rhs) const;
+
+  S21MatrixT operator*(const S21MatrixT& other) const;
+  template <typename E>
+  S21MatrixT operator*(const S21MatrixExpr<E>& expr) const;
+  bool operator==(const S21MatrixT& other) const noexcept;
+  template <typename E>
+  bool operator==(const S21MatrixExpr<E>& expr) const noexcept;
+  S21MatrixT& operator=(const S21MatrixT& other);
+  // Takes over other's buffer, unless it came from an S21MatrixArena this
+  // matrix's own buffer did not come from; then the elements are copied.
+  S21MatrixT& operator=(S21MatrixT&& other);
+  template <typename E>
+  S21MatrixT& operator=(const S21MatrixExpr<E>& expr);
+  S21MatrixT& operator+=(const S21MatrixT& other);
+  S21MatrixT& operator-=(const S21MatrixT& other);
+  template <typename E>
+  S21MatrixT& operator+=(const S21MatrixExpr<E>& expr);
+  template <typename E>
+  S21MatrixT& operator-=(const S21MatrixExpr<E>& expr);
+  S21MatrixT& operator*=(const S21MatrixT& other);
+  S21MatrixT& operator*=(const T num);
+  T& operator()(int i, int j) const;
+
+  // Unchecked access for hot loops; i and j must be in range. Row i starts
+  // at RowPtr(i) == Data() + i * GetStride(); the padding past GetCols() in
+  // each row holds no elements.
+  T& Get(int i, int j) noexcept;
+  T Get(int i, int j) const noexcept;
+  T* Data() noexcept;
+  const T* Data() const noexcept;
+  T* RowPtr(int i) noexcept;
+  const T* RowPtr(int i) const noexcept;
+  S21RowView<T> Row(int i) noexcept;
+  S21RowView<const T> Row(int i) const noexcept;
+  // Read-only views into this matrix; see S21MatrixViewT.
+  S21MatrixViewT<T> Block(int row, int col, int rows, int cols) const;
+  S21MatrixViewT<T> RowRange(int first, int count) const;
 
   int SwapRows(int m);
-  double CalcMinor(int crossed_out_rows, int crossed_out_columns,
-                   int order) const;
+  T CalcMinor(int crossed_out_rows, int crossed_out_columns, int order) const;
   void PrintMatrix();
 
  protected:
  private:
-  int rows_, cols_;
-  double* matrix_;
+  friend class S21LUT<T>;
+  friend class S21MatrixViewT<T>;
+
+  // Tag for results that are fully overwritten right after construction.
+  struct Uninitialized {};
+  S21MatrixT(int rows, int cols, Uninitialized);
+
+  static constexpr int kInlineBytes = 128;
+  static constexpr long kInlineElements = kInlineBytes / sizeof(T);
+
+  // Row length padded to whole 64-byte lines, plus one more line when rows
+  // would start a multiple of 1 KiB apart and collide in the same cache sets.
+  static int LeadingDimension(int cols) noexcept;
+  // Uninitialized 64-byte aligned storage for rows rows of stride elements:
+  // the inline buffer when they fit, otherwise a block from the calling
+  // thread's S21MatrixPool, or nullptr when the size is empty.
+  T* Allocate(int rows, int stride);
+  // The same for a buffer that replaces matrix_: an active S21MatrixArena
+  // only serves it if it also served matrix_.
+  T* AllocateReplacement(int rows, int stride);
+  // Returns a buffer from Allocate to the pool; the inline one is ignored.
+  void Release(T* data) noexcept;
+  T* Inline() noexcept;
+  bool IsInline() const noexcept;
+  // The arena matrix_ was carved from, or nullptr.
+  const S21MatrixArena* Arena() const noexcept;
+  // Takes over other's elements: its buffer, or a copy of its inline ones.
+  void Steal(S21MatrixT& other) noexcept;
+  // Moves the elements to a new buffer of capacity rows of stride elements
+  // and returns the old buffer, which the caller releases. The new buffer
+  // comes from AllocateReplacement, so a matrix that predates an arena
+  // never grows into it.
+  T* Reallocate(int capacity, int stride);
+
+  template <typename E>
+  void Evaluate(const E& expr) noexcept;
+
+  static inline real_type eq_tolerance_ = S21ScalarTraits<T>::Tolerance();
+
+  int rows_, cols_, stride_, capacity_;
+  T* matrix_;
+  alignas(64) unsigned char inline_[kInlineBytes];
 };
 
+using S21Matrix = S21MatrixT<double>;
+
+template <typename T>
+S21MatrixViewT<T>::S21MatrixViewT(const S21MatrixT<T>& matrix) noexcept
+    : data_(matrix.Data()),
+      rows_(matrix.rows_),
+      cols_(matrix.cols_),
+      stride_(matrix.stride_) {}
+
+template <typename T>
+int S21MatrixT<T>::GetStride() const noexcept {
+  return stride_;
+}
+
+template <typename T>
+int S21MatrixT<T>::GetRowCapacity() const noexcept {
+  return capacity_;
+}
+
+template <typename T>
+typename S21MatrixT<T>::real_type S21MatrixT<T>::GetEqTolerance() noexcept {
+  return eq_tolerance_;
+}
+
+template <typename T>
+void S21MatrixT<T>::SetEqTolerance(real_type eps) noexcept {
+  eq_tolerance_ = eps;
+}
+
+template <typename T>
+T& S21MatrixT<T>::Get(int i, int j) noexcept {
+  return matrix_[static_cast<long>(i) * stride_ + j];
+}
+
+template <typename T>
+T S21MatrixT<T>::Get(int i, int j) const noexcept {
+  return matrix_[static_cast<long>(i) * stride_ + j];
+}
+
+template <typename T>
+T* S21MatrixT<T>::Data() noexcept {
+  return matrix_;
+}
+
+template <typename T>
+const T* S21MatrixT<T>::Data() const noexcept {
+  return matrix_;
+}
+
+template <typename T>
+T* S21MatrixT<T>::RowPtr(int i) noexcept {
+  return matrix_ + static_cast<long>(i) * stride_;
+}
+
+template <typename T>
+const T* S21MatrixT<T>::RowPtr(int i) const noexcept {
+  return matrix_ + static_cast<long>(i) * stride_;
+}
+
+template <typename T>
+S21RowView<T> S21MatrixT<T>::Row(int i) noexcept {
+  return {RowPtr(i), cols_};
+}
+
+template <typename T>
+S21RowView<const T> S21MatrixT<T>::Row(int i) const noexcept {
+  return {RowPtr(i), cols_};
+}
+
+template <typename T>
+template <typename E>
+S21MatrixT<T>::S21MatrixT(const S21MatrixExpr<E>& expr)
+    : rows_(expr.GetRows()),
+      cols_(expr.GetCols()),
+      stride_(LeadingDimension(cols_)),
+      capacity_(rows_),
+      matrix_(Allocate(rows_, stride_)) {
+  static_assert(std::is_same<T, typename E::value_type>::value,
+                "Matrices must have the same element type");
+  Evaluate(typename S21ExprNode<E>::type(expr.Self()));
+}
+
+template <typename T>
+template <typename E>
+S21MatrixT<T>& S21MatrixT<T>::operator=(const S21MatrixExpr<E>& expr) {
+  if (rows_ != expr.GetRows() || cols_ != expr.GetCols()) {
+    *this = S21MatrixT(expr);
+  } else {
+    Evaluate(typename S21ExprNode<E>::type(expr.Self()));
+  }
+
+  return *this;
+}
+
+template <typename T>
+template <typename E>
+S21MatrixT<T> S21MatrixT<T>::operator*(const S21MatrixExpr<E>& expr) const {
+  return S21Multiply<T>(*this, S21Materialize(expr.Self()));
+}
+
+template <typename T>
+template <typename E>
+bool S21MatrixT<T>::operator==(const S21MatrixExpr<E>& expr) const noexcept {
+  return EqMatrix(expr);
+}
+
+template <typename T>
+template <typename E>
+S21MatrixT<T>& S21MatrixT<T>::operator+=(const S21MatrixExpr<E>& expr) {
+  return *this = *this + expr;
+}
+
+template <typename T>
+template <typename E>
+S21MatrixT<T>& S21MatrixT<T>::operator-=(const S21MatrixExpr<E>& expr) {
+  return *this = *this - expr;
+}
+
+template <typename T>
+template <typename E>
+void S21MatrixT<T>::Evaluate(const E& expr) noexcept {
+  for (int i = 0; i < rows_; ++i) {
+    T* row_ = RowPtr(i);
+    for (int j = 0; j < cols_; ++j) row_[j] = expr.Get(i, j);
+  }
+}
+
+template <typename E>
+auto S21MatrixExpr<E>::Eval() const {
+  return S21MatrixT<typename E::value_type>(*this);
+}
+
+template <typename E>
+auto S21MatrixExpr<E>::Transpose() const {
+  return Eval().Transpose();
+}
+
+template <typename E>
+auto S21MatrixExpr<E>::CalcComplements() const {
+  return Eval().CalcComplements();
+}
+
+template <typename E>
+auto S21MatrixExpr<E>::Determinant() const {
+  return Eval().Determinant();
+}
+
+template <typename E>
+auto S21MatrixExpr<E>::InverseMatrix() const {
+  return Eval().InverseMatrix();
+}
+
+template <typename E>
+template <typename M>
+auto S21MatrixExpr<E>::Solve(const M& rhs) const {
+  return Eval().Solve(rhs);
+}
+
+// Overloads for expiring S21MatrixT operands: the result is written into
+// the operand's buffer, so chains over temporaries allocate nothing extra.
+template <typename T, typename R>
+S21MatrixT<T> operator+(S21MatrixT<T>&& lhs, const S21MatrixExpr<R>& rhs) {
+  lhs += rhs;
+  return std::move(lhs);
+}
+
+template <typename L, typename T>
+S21MatrixT<T> operator+(const S21MatrixExpr<L>& lhs, S21MatrixT<T>&& rhs) {
+  rhs = lhs + rhs;
+  return std::move(rhs);
+}
+
+template <typename T, typename R>
+S21MatrixT<T> operator-(S21MatrixT<T>&& lhs, const S21MatrixExpr<R>& rhs) {
+  lhs -= rhs;
+  return std::move(lhs);
+}
+
+template <typename L, typename T>
+S21MatrixT<T> operator-(const S21MatrixExpr<L>& lhs, S21MatrixT<T>&& rhs) {
+  rhs = lhs - rhs;
+  return std::move(rhs);
+}
+
+template <typename T>
+S21MatrixT<T> operator+(S21MatrixT<T>&& lhs, S21MatrixT<T>&& rhs) {
+  lhs += rhs;
+  return std::move(lhs);
+}
+
+template <typename T>
+S21MatrixT<T> operator-(S21MatrixT<T>&& lhs, S21MatrixT<T>&& rhs) {
+  lhs -= rhs;
+  return std::move(lhs);
+}
+
+template <typename T>
+S21MatrixT<T> operator*(S21MatrixT<T>&& matrix,
+                        const typename S21MatrixT<T>::value_type num) {
+  matrix.MulNumber(num);
+  return std::move(matrix);
+}
+
+template <typename T>
+S21MatrixT<T> operator*(const typename S21MatrixT<T>::value_type num,
+                        S21MatrixT<T>&& matrix) {
+  matrix.MulNumber(num);
+  return std::move(matrix);
+}
+
+template <typename T>
+const S21MatrixT<T>& S21Materialize(const S21MatrixT<T>& matrix) noexcept {
+  return matrix;
+}
+
+template <typename T>
+const S21MatrixViewT<T>& S21Materialize(
+    const S21MatrixViewT<T>& view) noexcept {
+  return view;
+}
+
+template <typename E>
+S21MatrixT<typename E::value_type> S21Materialize(
+    const S21MatrixExpr<E>& expr) {
+  return S21MatrixT<typename E::value_type>(expr);
+}
+
+template <typename L, typename R>
+S21MatrixT<typename L::value_type> operator*(const S21MatrixExpr<L>& lhs,
+                                             const S21MatrixExpr<R>& rhs) {
+  return S21Multiply<typename L::value_type>(S21Materialize(lhs.Self()),
+                                             S21Materialize(rhs.Self()));
+}
+
 #endif  // CPP1_S21_MATRIXPLUS_1_S21_MATRIX_OOP_H_
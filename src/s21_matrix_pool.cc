@@ -0,0 +1,238 @@
+#include "s21_matrix_pool.h"
+
+#include <cstdint>
+
+namespace {
+
+constexpr std::uintptr_t kAlignment = 64;
+constexpr int kSmallClasses = 4;
+// Quarter-power-of-two classes up to 256 MiB; larger blocks bypass the cache.
+constexpr int kClasses = kSmallClasses + (28 - 8) * 4;
+constexpr int kHeapClass = -1;
+constexpr int kArenaClass = -2;
+constexpr std::size_t kDefaultCacheLimit = std::size_t(64) << 20;
+
+static_assert(__STDCPP_DEFAULT_NEW_ALIGNMENT__ >= 16,
+              "block headers need 16 bytes below the aligned data");
+
+// Sits right below the aligned data of every block. For arena blocks raw
+// points at the arena.
+struct BlockHeader {
+  char* raw;
+  long size_class;
+};
+
+BlockHeader& Header(void* data) noexcept {
+  return static_cast<BlockHeader*>(data)[-1];
+}
+
+// Classes are 64, 128, 192 and 256 bytes, then four per power of two:
+// 2^e + k * 2^(e - 2) for k = 1..4.
+int SizeClass(std::size_t bytes) noexcept {
+  if (bytes <= 256) return static_cast<int>((bytes + 63) / 64) - 1;
+
+  int e = 63 - __builtin_clzll(bytes - 1);
+  std::size_t step = std::size_t(1) << (e - 2);
+  int k = static_cast<int>((bytes - (std::size_t(1) << e) + step - 1) / step);
+  int size_class = kSmallClasses + (e - 8) * 4 + k - 1;
+
+  return size_class < kClasses ? size_class : kHeapClass;
+}
+
+std::size_t ClassBytes(int size_class) noexcept {
+  if (size_class < kSmallClasses) return (size_class + 1) * std::size_t(64);
+
+  int e = 8 + (size_class - kSmallClasses) / 4;
+  int k = (size_class - kSmallClasses) % 4 + 1;
+
+  return (std::size_t(1) << e) + k * (std::size_t(1) << (e - 2));
+}
+
+char* AlignUp(char* address) noexcept {
+  std::uintptr_t value = reinterpret_cast<std::uintptr_t>(address);
+  value = (value + kAlignment - 1) & ~(kAlignment - 1);
+  return reinterpret_cast<char*>(value);
+}
+
+// new[] returns at least 16-byte aligned memory, so the first line boundary
+// past the header is at most one line into the block.
+char* HeapBlock(std::size_t bytes, int size_class) {
+  char* raw = new char[bytes + kAlignment];
+  char* data = AlignUp(raw + sizeof(BlockHeader));
+  Header(data) = {raw, size_class};
+
+  return data;
+}
+
+void FreeBlock(void* data) noexcept { delete[] Header(data).raw; }
+
+thread_local S21MatrixPool* local_pool = nullptr;
+thread_local bool local_pool_gone = false;
+
+// Destroys the calling thread's pool at thread exit.
+struct LocalPoolOwner {
+  ~LocalPoolOwner() {
+    delete local_pool;
+    local_pool = nullptr;
+    local_pool_gone = true;
+  }
+};
+
+}  // namespace
+
+S21MatrixPool& S21MatrixPool::Local() {
+  if (local_pool) return *local_pool;
+
+  if (local_pool_gone) {
+    // Matrices destroyed after thread-local teardown, e.g. statics at exit.
+    static S21MatrixPool* const uncached = [] {
+      S21MatrixPool* pool = new S21MatrixPool;
+      pool->cache_limit_ = 0;
+      return pool;
+    }();
+    return *uncached;
+  }
+
+  thread_local LocalPoolOwner owner;
+  local_pool = new S21MatrixPool;
+
+  return *local_pool;
+}
+
+S21MatrixPool::S21MatrixPool()
+    : free_(kClasses, nullptr),
+      cached_bytes_(0),
+      cache_limit_(kDefaultCacheLimit),
+      arena_(nullptr),
+      stats_{0, 0, 0, 0} {}
+
+S21MatrixPool::~S21MatrixPool() { Trim(); }
+
+void* S21MatrixPool::Allocate(std::size_t bytes) {
+  ++stats_.requests;
+  if (arena_) {
+    ++stats_.arena;
+    return arena_->Allocate(bytes);
+  }
+
+  return AllocateFromCache(bytes);
+}
+
+void* S21MatrixPool::Allocate(std::size_t bytes, const void* replaced) {
+  if (arena_ && replaced && ArenaOf(replaced) == arena_) {
+    return Allocate(bytes);
+  }
+
+  ++stats_.requests;
+  return AllocateFromCache(bytes);
+}
+
+const S21MatrixArena* S21MatrixPool::ArenaOf(const void* data) noexcept {
+  const BlockHeader& header = Header(const_cast<void*>(data));
+  if (header.size_class != kArenaClass) return nullptr;
+
+  return reinterpret_cast<const S21MatrixArena*>(header.raw);
+}
+
+void* S21MatrixPool::AllocateFromCache(std::size_t bytes) {
+  int size_class = SizeClass(bytes);
+  if (size_class != kHeapClass && free_[size_class]) {
+    char* data = free_[size_class];
+    free_[size_class] = *reinterpret_cast<char**>(data);
+    cached_bytes_ -= ClassBytes(size_class);
+    ++stats_.reused;
+    return data;
+  }
+
+  ++stats_.heap_allocations;
+  if (size_class == kHeapClass) return HeapBlock(bytes, kHeapClass);
+
+  return HeapBlock(ClassBytes(size_class), size_class);
+}
+
+void S21MatrixPool::Release(void* data) noexcept {
+  if (!data) return;
+
+  long size_class = Header(data).size_class;
+  if (size_class == kArenaClass) return;
+
+  if (size_class == kHeapClass || local_pool_gone) {
+    FreeBlock(data);
+  } else {
+    Local().Recycle(static_cast<char*>(data),
+                    static_cast<int>(size_class));
+  }
+}
+
+void S21MatrixPool::Recycle(char* data, int size_class) noexcept {
+  std::size_t bytes = ClassBytes(size_class);
+  if (cached_bytes_ + bytes > cache_limit_) {
+    FreeBlock(data);
+    return;
+  }
+
+  *reinterpret_cast<char**>(data) = free_[size_class];
+  free_[size_class] = data;
+  cached_bytes_ += bytes;
+}
+
+std::size_t S21MatrixPool::GetCacheLimit() const noexcept {
+  return cache_limit_;
+}
+
+void S21MatrixPool::SetCacheLimit(std::size_t bytes) noexcept {
+  cache_limit_ = bytes;
+  if (cached_bytes_ > cache_limit_) Trim();
+}
+
+void S21MatrixPool::Trim() noexcept {
+  for (char*& head : free_) {
+    while (head) {
+      char* next = *reinterpret_cast<char**>(head);
+      FreeBlock(head);
+      head = next;
+    }
+  }
+  cached_bytes_ = 0;
+}
+
+S21MatrixPool::Stats S21MatrixPool::GetStats() const noexcept {
+  return stats_;
+}
+
+S21MatrixArena::S21MatrixArena(std::size_t chunk_bytes)
+    : previous_(S21MatrixPool::Local().arena_),
+      chunk_bytes_(chunk_bytes),
+      cursor_(nullptr),
+      limit_(nullptr),
+      used_(0) {
+  S21MatrixPool::Local().arena_ = this;
+}
+
+S21MatrixArena::~S21MatrixArena() {
+  S21MatrixPool::Local().arena_ = previous_;
+  for (char* chunk : chunks_) delete[] chunk;
+}
+
+std::size_t S21MatrixArena::GetUsed() const noexcept { return used_; }
+
+char* S21MatrixArena::Allocate(std::size_t bytes) {
+  // One line for the header, then the data rounded up to whole lines.
+  std::size_t need =
+      kAlignment + (bytes + kAlignment - 1) / kAlignment * kAlignment;
+  if (!cursor_ || static_cast<std::size_t>(limit_ - cursor_) < need) {
+    std::size_t size = (need > chunk_bytes_ ? need : chunk_bytes_) + kAlignment;
+    chunks_.reserve(chunks_.size() + 1);
+    char* chunk = new char[size];
+    chunks_.push_back(chunk);
+    cursor_ = AlignUp(chunk);
+    limit_ = chunk + size;
+  }
+
+  char* data = cursor_ + kAlignment;
+  Header(data) = {reinterpret_cast<char*>(this), kArenaClass};
+  cursor_ += need;
+  used_ += need;
+
+  return data;
+}
@@ -0,0 +1,95 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_S21_MATRIX_POOL_H_
+#define CPP1_S21_MATRIXPLUS_1_S21_MATRIX_POOL_H_
+
+#include <cstddef>
+#include <vector>
+
+class S21MatrixArena;
+
+// Per-thread cache of 64-byte aligned matrix buffers. Released blocks are
+// kept in size classes a quarter of a power of two apart and handed to the
+// next request of the same class on that thread, so loops that create and
+// destroy same-sized temporaries stop reaching the global heap. A block may
+// be released on any thread; it joins that thread's cache.
+class S21MatrixPool {
+ public:
+  struct Stats {
+    long requests;          // Allocate calls
+    long reused;            // served from the cache
+    long arena;             // served by an S21MatrixArena
+    long heap_allocations;  // served by operator new[]
+  };
+
+  // The pool of the calling thread.
+  static S21MatrixPool& Local();
+
+  S21MatrixPool(const S21MatrixPool&) = delete;
+  S21MatrixPool& operator=(const S21MatrixPool&) = delete;
+  ~S21MatrixPool();
+
+  // Uninitialized aligned storage of bytes bytes; bytes must be positive.
+  void* Allocate(std::size_t bytes);
+  // The same, for a block that takes over from replaced, as when a matrix
+  // grows or is reassigned. The active arena serves it only if it also
+  // served replaced, so storage that predates the arena never moves into
+  // it. Null stands for storage that is not a block, such as none at all.
+  void* Allocate(std::size_t bytes, const void* replaced);
+  // The arena a block from Allocate was carved from, or nullptr.
+  static const S21MatrixArena* ArenaOf(const void* data) noexcept;
+  // Returns a block from Allocate to the calling thread's cache, or frees
+  // it when the cache is full. Null is ignored.
+  static void Release(void* data) noexcept;
+
+  std::size_t GetCacheLimit() const noexcept;
+  // Bytes of free blocks this thread may keep; 0 turns caching off.
+  void SetCacheLimit(std::size_t bytes) noexcept;
+  // Frees every cached block.
+  void Trim() noexcept;
+  Stats GetStats() const noexcept;
+
+ private:
+  friend class S21MatrixArena;
+
+  S21MatrixPool();
+
+  void* AllocateFromCache(std::size_t bytes);
+  void Recycle(char* data, int size_class) noexcept;
+
+  std::vector<char*> free_;
+  std::size_t cached_bytes_;
+  std::size_t cache_limit_;
+  S21MatrixArena* arena_;
+  Stats stats_;
+};
+
+// Bump allocator for a scope full of temporaries. While it is alive, every
+// new matrix buffer requested on the constructing thread is carved out of
+// its chunks, releasing one is free, and the destructor returns all chunks
+// at once. Matrices created in the scope must not outlive it. Matrices
+// created before it may be used inside: when one grows or is assigned to,
+// any new buffer it needs comes from the pool, as it would without the
+// arena. Arenas nest.
+class S21MatrixArena {
+ public:
+  explicit S21MatrixArena(std::size_t chunk_bytes = 1 << 20);
+  S21MatrixArena(const S21MatrixArena&) = delete;
+  S21MatrixArena& operator=(const S21MatrixArena&) = delete;
+  ~S21MatrixArena();
+
+  // Bytes handed out so far, headers and alignment included.
+  std::size_t GetUsed() const noexcept;
+
+ private:
+  friend class S21MatrixPool;
+
+  char* Allocate(std::size_t bytes);
+
+  S21MatrixArena* previous_;
+  std::vector<char*> chunks_;
+  std::size_t chunk_bytes_;
+  char* cursor_;
+  char* limit_;
+  std::size_t used_;
+};
+
+#endif  // CPP1_S21_MATRIXPLUS_1_S21_MATRIX_POOL_H_
@@ -0,0 +1,163 @@
+#include "s21_matrix_view.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+
+#include "s21_bareiss.h"
+#include "s21_gemm.h"
+#include "s21_lu.h"
+#include "s21_matrix_oop.h"
+#include "s21_strassen.h"
+#include "s21_transpose.h"
+
+template <typename T>
+S21MatrixViewT<T> S21MatrixViewT<T>::Block(int row, int col, int rows,
+                                           int cols) const {
+  if (rows < 1 || cols < 1)
+    throw std::invalid_argument(
+        "Incorrect input, matrix should have positive size");
+
+  if (row < 0 || col < 0 || row > rows_ - rows || col > cols_ - cols)
+    throw std::out_of_range("Incorrect input, index is out of range");
+
+  return {RowPtr(row) + col, rows, cols, stride_};
+}
+
+template <typename T>
+S21MatrixViewT<T> S21MatrixViewT<T>::RowRange(int first, int count) const {
+  return Block(first, 0, count, cols_);
+}
+
+template <typename T>
+S21MatrixT<T> S21MatrixViewT<T>::Transpose() const {
+  S21MatrixT<T> res_(cols_, rows_, typename S21MatrixT<T>::Uninitialized());
+  S21Transpose(data_, rows_, cols_, stride_, res_.matrix_, res_.stride_);
+
+  return res_;
+}
+
+template <typename T>
+T S21MatrixViewT<T>::Determinant() const {
+  if (rows_ != cols_) throw std::logic_error("Matrix must be square");
+
+  T res_ = S21LUT<T>(*this).Determinant();
+  if constexpr (!S21ScalarTraits<T>::kIsComplex) {
+    if (std::abs(res_) <= T(1e-6)) res_ = std::abs(res_);
+  }
+
+  return res_;
+}
+
+template <typename T>
+__int128 S21MatrixViewT<T>::ExactDeterminant() const {
+  if (rows_ != cols_) throw std::logic_error("Matrix must be square");
+
+  if constexpr (S21ScalarTraits<T>::kIsComplex) {
+    throw std::invalid_argument("Matrix must have integer elements");
+  } else {
+    return S21BareissDeterminant(data_, rows_, stride_);
+  }
+}
+
+template <typename T>
+S21LogDeterminant<T> S21MatrixViewT<T>::LogAbsDeterminant() const {
+  return S21LUT<T>(*this).LogAbsDeterminant();
+}
+
+template <typename T>
+S21MatrixT<T> S21Multiply(const S21MatrixViewT<T>& lhs,
+                          const S21MatrixViewT<T>& rhs) {
+  if (lhs.GetCols() != rhs.GetRows())
+    throw std::logic_error("Inconsistency in the number of columns and rows");
+
+  int m = lhs.GetRows(), n = rhs.GetCols(), k = lhs.GetCols();
+  int cutoff = S21GetStrassenCutoff();
+  if (cutoff > 0 && std::min({m, n, k}) >= cutoff) {
+    S21MatrixT<T> res_(m, n);
+    S21Strassen(m, n, k, lhs.Data(), lhs.GetStride(), rhs.Data(),
+                rhs.GetStride(), res_.Data(), res_.GetStride());
+    return res_;
+  }
+
+  S21MatrixT<T> res_(m, n);
+  S21Gemm(m, n, k, lhs.Data(), lhs.GetStride(), rhs.Data(), rhs.GetStride(),
+          res_.Data(), res_.GetStride());
+
+  return res_;
+}
+
+template <typename T>
+void S21Gemm(typename S21MatrixT<T>::value_type alpha,
+             const S21MatrixViewT<typename S21MatrixT<T>::value_type>& a,
+             bool trans_a,
+             const S21MatrixViewT<typename S21MatrixT<T>::value_type>& b,
+             bool trans_b, typename S21MatrixT<T>::value_type beta,
+             S21MatrixT<T>& c) {
+  int m = trans_a ? a.GetCols() : a.GetRows();
+  int k = trans_a ? a.GetRows() : a.GetCols();
+  int n = trans_b ? b.GetRows() : b.GetCols();
+  if ((trans_b ? b.GetCols() : b.GetRows()) != k)
+    throw std::logic_error("Inconsistency in the number of columns and rows");
+
+  if (c.GetRows() == 0) {
+    c = S21MatrixT<T>(m, n);
+  } else if (c.GetRows() != m || c.GetCols() != n) {
+    throw std::logic_error("Matrices must be of the same dimension");
+  }
+
+  // Writing c while it is still being read would corrupt the product.
+  const T* begin = c.Data();
+  const T* end = c.RowPtr(m - 1) + n;
+  auto overlaps = [begin, end](const S21MatrixViewT<T>& view) {
+    const T* first = view.Data();
+    const T* last = view.RowPtr(view.GetRows() - 1) + view.GetCols();
+    return first < end && begin < last;
+  };
+  if (overlaps(a) || overlaps(b)) {
+    S21MatrixT<T> res_(c);
+    S21Gemm(alpha, a, trans_a, b, trans_b, beta, res_);
+    c = std::move(res_);
+    return;
+  }
+
+  int cutoff = S21GetStrassenCutoff();
+  if (!trans_a && !trans_b && alpha == T(1) && beta == T(0) && cutoff > 0 &&
+      std::min({m, n, k}) >= cutoff) {
+    S21Strassen(m, n, k, a.Data(), a.GetStride(), b.Data(), b.GetStride(),
+                c.Data(), c.GetStride());
+    return;
+  }
+
+  S21Gemm(trans_a, trans_b, m, n, k, alpha, a.Data(), a.GetStride(),
+          b.Data(), b.GetStride(), beta, c.Data(), c.GetStride());
+}
+
+template class S21MatrixViewT<float>;
+template class S21MatrixViewT<double>;
+template class S21MatrixViewT<long double>;
+template class S21MatrixViewT<std::complex<double>>;
+
+template S21MatrixT<float> S21Multiply(const S21MatrixViewT<float>&,
+                                       const S21MatrixViewT<float>&);
+template S21MatrixT<double> S21Multiply(const S21MatrixViewT<double>&,
+                                        const S21MatrixViewT<double>&);
+template S21MatrixT<long double> S21Multiply(
+    const S21MatrixViewT<long double>&, const S21MatrixViewT<long double>&);
+template S21MatrixT<std::complex<double>> S21Multiply(
+    const S21MatrixViewT<std::complex<double>>&,
+    const S21MatrixViewT<std::complex<double>>&);
+template void S21Gemm(float, const S21MatrixViewT<float>&, bool,
+                      const S21MatrixViewT<float>&, bool, float,
+                      S21MatrixT<float>&);
+template void S21Gemm(double, const S21MatrixViewT<double>&, bool,
+                      const S21MatrixViewT<double>&, bool, double,
+                      S21MatrixT<double>&);
+template void S21Gemm(long double, const S21MatrixViewT<long double>&, bool,
+                      const S21MatrixViewT<long double>&, bool, long double,
+                      S21MatrixT<long double>&);
+template void S21Gemm(std::complex<double>,
+                      const S21MatrixViewT<std::complex<double>>&, bool,
+                      const S21MatrixViewT<std::complex<double>>&, bool,
+                      std::complex<double>, S21MatrixT<std::complex<double>>&);
@@ -0,0 +1,79 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_S21_MATRIX_VIEW_H_
+#define CPP1_S21_MATRIXPLUS_1_S21_MATRIX_VIEW_H_
+
+#include "s21_matrix_expr.h"
+
+// A determinant as sign * exp(log_abs), which neither overflows nor
+// underflows where the product of pivots would. sign is -1, 0 or 1, or for
+// complex T the unit phase; a singular matrix has sign 0 and log_abs -inf.
+template <typename T>
+struct S21LogDeterminant {
+  T sign;
+  typename S21ScalarTraits<T>::real_type log_abs;
+};
+
+// Non-owning, read-only window onto rows x cols row-major elements spaced
+// stride elements apart: a whole S21MatrixT, one of its blocks or a row
+// range. Making a view copies nothing, and it stays valid until the matrix
+// it looks into is resized or destroyed, or moved if it stores its elements
+// inline. Views are the leaves of the element-wise expression templates, so
+// they mix with matrices in +, - and scalar *.
+template <typename T>
+class S21MatrixViewT : public S21MatrixExpr<S21MatrixViewT<T>> {
+ public:
+  using value_type = T;
+
+  S21MatrixViewT(const T* data, int rows, int cols, int stride) noexcept
+      : data_(data), rows_(rows), cols_(cols), stride_(stride) {}
+  S21MatrixViewT(const S21MatrixT<T>& matrix) noexcept;
+
+  int GetRows() const noexcept { return rows_; }
+  int GetCols() const noexcept { return cols_; }
+  int GetStride() const noexcept { return stride_; }
+  const T* Data() const noexcept { return data_; }
+  const T* RowPtr(int i) const noexcept {
+    return data_ + static_cast<long>(i) * stride_;
+  }
+  T Get(int i, int j) const noexcept { return RowPtr(i)[j]; }
+
+  // The rows x cols block whose top-left element is (row, col).
+  S21MatrixViewT Block(int row, int col, int rows, int cols) const;
+  S21MatrixViewT RowRange(int first, int count) const;
+
+  S21MatrixT<T> Transpose() const;
+  // From S21LUT, rounding error included; ExactDeterminant is the exact
+  // alternative for integer-valued matrices.
+  T Determinant() const;
+  // The exact determinant of an integer-valued matrix; see
+  // S21BareissDeterminant.
+  __int128 ExactDeterminant() const;
+  // From the same factorization as Determinant().
+  S21LogDeterminant<T> LogAbsDeterminant() const;
+
+ private:
+  const T* data_;
+  int rows_, cols_, stride_;
+};
+
+using S21MatrixView = S21MatrixViewT<double>;
+
+// lhs * rhs through S21Gemm, reading both operands in place. T is not
+// deduced from matrices, so callers passing them name it: S21Multiply<T>.
+template <typename T>
+S21MatrixT<T> S21Multiply(const S21MatrixViewT<T>& lhs,
+                          const S21MatrixViewT<T>& rhs);
+
+// c = alpha * op(a) * op(b) + beta * c, written into c's existing storage;
+// op transposes its operand, in place, when the matching flag is set. An
+// empty c is first sized to the product, otherwise it must already have
+// that size. c may overlap a or b, at the cost of one temporary. T comes
+// from c, so matrices and views both pass as a and b.
+template <typename T>
+void S21Gemm(typename S21MatrixT<T>::value_type alpha,
+             const S21MatrixViewT<typename S21MatrixT<T>::value_type>& a,
+             bool trans_a,
+             const S21MatrixViewT<typename S21MatrixT<T>::value_type>& b,
+             bool trans_b, typename S21MatrixT<T>::value_type beta,
+             S21MatrixT<T>& c);
+
+#endif  // CPP1_S21_MATRIXPLUS_1_S21_MATRIX_VIEW_H_
@@ -0,0 +1,24 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_S21_ROW_VIEW_H_
+#define CPP1_S21_MATRIXPLUS_1_S21_ROW_VIEW_H_
+
+// Non-owning view of one matrix row, shaped after std::span. T is double for
+// a writable row and const double for a read-only one. Indexing is not
+// checked; the view is valid until the matrix is resized or destroyed.
+template <typename T>
+class S21RowView {
+ public:
+  S21RowView(T* data, int size) noexcept : data_(data), size_(size) {}
+
+  T* data() const noexcept { return data_; }
+  int size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+  T* begin() const noexcept { return data_; }
+  T* end() const noexcept { return data_ + size_; }
+  T& operator[](int j) const noexcept { return data_[j]; }
+
+ private:
+  T* data_;
+  int size_;
+};
+
+#endif  // CPP1_S21_MATRIXPLUS_1_S21_ROW_VIEW_H_
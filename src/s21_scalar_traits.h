@@ -0,0 +1,34 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_S21_SCALAR_TRAITS_H_
+#define CPP1_S21_MATRIXPLUS_1_S21_SCALAR_TRAITS_H_
+
+#include <complex>
+
+// Per element type constants of S21MatrixT. real_type is the type of
+// magnitudes and tolerances, and Tolerance() is the EqMatrix default: a
+// fixed 1e-6, except for float, whose 24-bit mantissa cannot resolve 1e-6
+// past magnitude 8. Specialize the struct to change the default for a type.
+template <typename T>
+struct S21ScalarTraits {
+  using real_type = T;
+  static constexpr bool kIsComplex = false;
+  static constexpr real_type Tolerance() noexcept { return real_type(1e-6); }
+};
+
+template <>
+struct S21ScalarTraits<float> {
+  using real_type = float;
+  static constexpr bool kIsComplex = false;
+  static constexpr float Tolerance() noexcept { return 1e-4f; }
+};
+
+// Complex values compare by the modulus of their difference.
+template <typename T>
+struct S21ScalarTraits<std::complex<T>> {
+  using real_type = T;
+  static constexpr bool kIsComplex = true;
+  static constexpr real_type Tolerance() noexcept {
+    return S21ScalarTraits<T>::Tolerance();
+  }
+};
+
+#endif  // CPP1_S21_MATRIXPLUS_1_S21_SCALAR_TRAITS_H_
@@ -0,0 +1,557 @@
+#include "s21_simd.h"
+
+#include <cmath>
+#include <complex>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define S21_SIMD_X86 1
+#endif
+
+namespace {
+
+template <typename T>
+void AddScalar(T* dst, const T* src, long n) {
+  for (long i = 0; i < n; ++i) dst[i] += src[i];
+}
+
+template <typename T>
+void SubScalar(T* dst, const T* src, long n) {
+  for (long i = 0; i < n; ++i) dst[i] -= src[i];
+}
+
+template <typename T>
+void ScaleScalar(T* dst, T num, long n) {
+  for (long i = 0; i < n; ++i) dst[i] *= num;
+}
+
+template <typename T>
+bool EqualScalar(const T* a, const T* b, long n,
+                 typename S21ScalarTraits<T>::real_type eps) {
+  for (long i = 0; i < n; ++i) {
+    if (std::abs(a[i] - b[i]) > eps) return false;
+  }
+  return true;
+}
+
+template <typename T>
+void TransposeScalar(const T* a, int rows, int cols, int lda, T* b, int ldb) {
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) b[j * ldb + i] = a[i * lda + j];
+  }
+}
+
+#ifdef S21_SIMD_X86
+
+__attribute__((target("sse2"))) void AddSse2(double* dst, const double* src,
+                                              long n) {
+  long i = 0;
+  for (; i + 2 <= n; i += 2) {
+    _mm_storeu_pd(dst + i,
+                  _mm_add_pd(_mm_loadu_pd(dst + i), _mm_loadu_pd(src + i)));
+  }
+  AddScalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("sse2"))) void SubSse2(double* dst, const double* src,
+                                              long n) {
+  long i = 0;
+  for (; i + 2 <= n; i += 2) {
+    _mm_storeu_pd(dst + i,
+                  _mm_sub_pd(_mm_loadu_pd(dst + i), _mm_loadu_pd(src + i)));
+  }
+  SubScalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("sse2"))) void ScaleSse2(double* dst, double num,
+                                                long n) {
+  __m128d k = _mm_set1_pd(num);
+  long i = 0;
+  for (; i + 2 <= n; i += 2) {
+    _mm_storeu_pd(dst + i, _mm_mul_pd(_mm_loadu_pd(dst + i), k));
+  }
+  ScaleScalar(dst + i, num, n - i);
+}
+
+__attribute__((target("sse2"))) bool EqualSse2(const double* a,
+                                                const double* b, long n,
+                                                double eps) {
+  __m128d sign = _mm_set1_pd(-0.0);
+  __m128d limit = _mm_set1_pd(eps);
+  long i = 0;
+  for (; i + 2 <= n; i += 2) {
+    __m128d diff = _mm_sub_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i));
+    __m128d gt = _mm_cmpgt_pd(_mm_andnot_pd(sign, diff), limit);
+    if (_mm_movemask_pd(gt)) return false;
+  }
+  return EqualScalar(a + i, b + i, n - i, eps);
+}
+
+__attribute__((target("sse2"))) void TransposeSse2(const double* a, int rows,
+                                                    int cols, int lda,
+                                                    double* b, int ldb) {
+  int i = 0;
+  for (; i + 2 <= rows; i += 2) {
+    int j = 0;
+    for (; j + 2 <= cols; j += 2) {
+      __m128d r0 = _mm_loadu_pd(a + i * lda + j);
+      __m128d r1 = _mm_loadu_pd(a + (i + 1) * lda + j);
+      _mm_storeu_pd(b + j * ldb + i, _mm_unpacklo_pd(r0, r1));
+      _mm_storeu_pd(b + (j + 1) * ldb + i, _mm_unpackhi_pd(r0, r1));
+    }
+    TransposeScalar(a + i * lda + j, 2, cols - j, lda, b + j * ldb + i, ldb);
+  }
+  TransposeScalar(a + i * lda, rows - i, cols, lda, b + i, ldb);
+}
+
+__attribute__((target("avx2"))) void AddAvx2(double* dst, const double* src,
+                                              long n) {
+  long i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256d x0 = _mm256_add_pd(_mm256_loadu_pd(dst + i),
+                               _mm256_loadu_pd(src + i));
+    __m256d x1 = _mm256_add_pd(_mm256_loadu_pd(dst + i + 4),
+                               _mm256_loadu_pd(src + i + 4));
+    _mm256_storeu_pd(dst + i, x0);
+    _mm256_storeu_pd(dst + i + 4, x1);
+  }
+  AddScalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("avx2"))) void SubAvx2(double* dst, const double* src,
+                                              long n) {
+  long i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256d x0 = _mm256_sub_pd(_mm256_loadu_pd(dst + i),
+                               _mm256_loadu_pd(src + i));
+    __m256d x1 = _mm256_sub_pd(_mm256_loadu_pd(dst + i + 4),
+                               _mm256_loadu_pd(src + i + 4));
+    _mm256_storeu_pd(dst + i, x0);
+    _mm256_storeu_pd(dst + i + 4, x1);
+  }
+  SubScalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("avx2"))) void ScaleAvx2(double* dst, double num,
+                                                long n) {
+  __m256d k = _mm256_set1_pd(num);
+  long i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256d x0 = _mm256_mul_pd(_mm256_loadu_pd(dst + i), k);
+    __m256d x1 = _mm256_mul_pd(_mm256_loadu_pd(dst + i + 4), k);
+    _mm256_storeu_pd(dst + i, x0);
+    _mm256_storeu_pd(dst + i + 4, x1);
+  }
+  ScaleScalar(dst + i, num, n - i);
+}
+
+__attribute__((target("avx2"))) bool EqualAvx2(const double* a,
+                                                const double* b, long n,
+                                                double eps) {
+  __m256d sign = _mm256_set1_pd(-0.0);
+  __m256d limit = _mm256_set1_pd(eps);
+  long i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m256d diff = _mm256_sub_pd(_mm256_loadu_pd(a + i),
+                                 _mm256_loadu_pd(b + i));
+    __m256d gt =
+        _mm256_cmp_pd(_mm256_andnot_pd(sign, diff), limit, _CMP_GT_OQ);
+    if (_mm256_movemask_pd(gt)) return false;
+  }
+  return EqualScalar(a + i, b + i, n - i, eps);
+}
+
+__attribute__((target("avx2"))) void TransposeAvx2(const double* a, int rows,
+                                                    int cols, int lda,
+                                                    double* b, int ldb) {
+  int i = 0;
+  for (; i + 4 <= rows; i += 4) {
+    int j = 0;
+    for (; j + 4 <= cols; j += 4) {
+      const double* src = a + i * lda + j;
+      __m256d r0 = _mm256_loadu_pd(src);
+      __m256d r1 = _mm256_loadu_pd(src + lda);
+      __m256d r2 = _mm256_loadu_pd(src + 2 * lda);
+      __m256d r3 = _mm256_loadu_pd(src + 3 * lda);
+      __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+      __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+      __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+      __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+      double* dst = b + j * ldb + i;
+      _mm256_storeu_pd(dst, _mm256_permute2f128_pd(t0, t2, 0x20));
+      _mm256_storeu_pd(dst + ldb, _mm256_permute2f128_pd(t1, t3, 0x20));
+      _mm256_storeu_pd(dst + 2 * ldb, _mm256_permute2f128_pd(t0, t2, 0x31));
+      _mm256_storeu_pd(dst + 3 * ldb, _mm256_permute2f128_pd(t1, t3, 0x31));
+    }
+    TransposeScalar(a + i * lda + j, 4, cols - j, lda, b + j * ldb + i, ldb);
+  }
+  TransposeScalar(a + i * lda, rows - i, cols, lda, b + i, ldb);
+}
+
+__attribute__((target("avx512f"))) void AddAvx512(double* dst,
+                                                   const double* src, long n) {
+  long i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm512_storeu_pd(dst + i, _mm512_add_pd(_mm512_loadu_pd(dst + i),
+                                            _mm512_loadu_pd(src + i)));
+  }
+  if (i < n) {
+    __mmask8 tail = static_cast<__mmask8>((1u << (n - i)) - 1);
+    _mm512_mask_storeu_pd(
+        dst + i, tail,
+        _mm512_add_pd(_mm512_maskz_loadu_pd(tail, dst + i),
+                      _mm512_maskz_loadu_pd(tail, src + i)));
+  }
+}
+
+__attribute__((target("avx512f"))) void SubAvx512(double* dst,
+                                                   const double* src, long n) {
+  long i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm512_storeu_pd(dst + i, _mm512_sub_pd(_mm512_loadu_pd(dst + i),
+                                            _mm512_loadu_pd(src + i)));
+  }
+  if (i < n) {
+    __mmask8 tail = static_cast<__mmask8>((1u << (n - i)) - 1);
+    _mm512_mask_storeu_pd(
+        dst + i, tail,
+        _mm512_sub_pd(_mm512_maskz_loadu_pd(tail, dst + i),
+                      _mm512_maskz_loadu_pd(tail, src + i)));
+  }
+}
+
+__attribute__((target("avx512f"))) void ScaleAvx512(double* dst, double num,
+                                                     long n) {
+  __m512d k = _mm512_set1_pd(num);
+  long i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm512_storeu_pd(dst + i, _mm512_mul_pd(_mm512_loadu_pd(dst + i), k));
+  }
+  if (i < n) {
+    __mmask8 tail = static_cast<__mmask8>((1u << (n - i)) - 1);
+    _mm512_mask_storeu_pd(
+        dst + i, tail, _mm512_mul_pd(_mm512_maskz_loadu_pd(tail, dst + i), k));
+  }
+}
+
+__attribute__((target("avx512f"))) bool EqualAvx512(const double* a,
+                                                     const double* b, long n,
+                                                     double eps) {
+  __m512d limit = _mm512_set1_pd(eps);
+  long i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m512d diff =
+        _mm512_sub_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i));
+    if (_mm512_cmp_pd_mask(_mm512_abs_pd(diff), limit, _CMP_GT_OQ))
+      return false;
+  }
+  return EqualScalar(a + i, b + i, n - i, eps);
+}
+
+__attribute__((target("sse2"))) void AddSse2(float* dst, const float* src,
+                                              long n) {
+  long i = 0;
+  for (; i + 4 <= n; i += 4) {
+    _mm_storeu_ps(dst + i,
+                  _mm_add_ps(_mm_loadu_ps(dst + i), _mm_loadu_ps(src + i)));
+  }
+  AddScalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("sse2"))) void SubSse2(float* dst, const float* src,
+                                              long n) {
+  long i = 0;
+  for (; i + 4 <= n; i += 4) {
+    _mm_storeu_ps(dst + i,
+                  _mm_sub_ps(_mm_loadu_ps(dst + i), _mm_loadu_ps(src + i)));
+  }
+  SubScalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("sse2"))) void ScaleSse2(float* dst, float num,
+                                                long n) {
+  __m128 k = _mm_set1_ps(num);
+  long i = 0;
+  for (; i + 4 <= n; i += 4) {
+    _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_loadu_ps(dst + i), k));
+  }
+  ScaleScalar(dst + i, num, n - i);
+}
+
+__attribute__((target("sse2"))) bool EqualSse2(const float* a, const float* b,
+                                                long n, float eps) {
+  __m128 sign = _mm_set1_ps(-0.0f);
+  __m128 limit = _mm_set1_ps(eps);
+  long i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128 diff = _mm_sub_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i));
+    __m128 gt = _mm_cmpgt_ps(_mm_andnot_ps(sign, diff), limit);
+    if (_mm_movemask_ps(gt)) return false;
+  }
+  return EqualScalar(a + i, b + i, n - i, eps);
+}
+
+__attribute__((target("sse2"))) void TransposeSse2(const float* a, int rows,
+                                                    int cols, int lda,
+                                                    float* b, int ldb) {
+  int i = 0;
+  for (; i + 4 <= rows; i += 4) {
+    int j = 0;
+    for (; j + 4 <= cols; j += 4) {
+      const float* src = a + i * lda + j;
+      __m128 r0 = _mm_loadu_ps(src);
+      __m128 r1 = _mm_loadu_ps(src + lda);
+      __m128 r2 = _mm_loadu_ps(src + 2 * lda);
+      __m128 r3 = _mm_loadu_ps(src + 3 * lda);
+      _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+      float* dst = b + j * ldb + i;
+      _mm_storeu_ps(dst, r0);
+      _mm_storeu_ps(dst + ldb, r1);
+      _mm_storeu_ps(dst + 2 * ldb, r2);
+      _mm_storeu_ps(dst + 3 * ldb, r3);
+    }
+    TransposeScalar(a + i * lda + j, 4, cols - j, lda, b + j * ldb + i, ldb);
+  }
+  TransposeScalar(a + i * lda, rows - i, cols, lda, b + i, ldb);
+}
+
+__attribute__((target("avx2"))) void AddAvx2(float* dst, const float* src,
+                                              long n) {
+  long i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m256 x0 = _mm256_add_ps(_mm256_loadu_ps(dst + i),
+                              _mm256_loadu_ps(src + i));
+    __m256 x1 = _mm256_add_ps(_mm256_loadu_ps(dst + i + 8),
+                              _mm256_loadu_ps(src + i + 8));
+    _mm256_storeu_ps(dst + i, x0);
+    _mm256_storeu_ps(dst + i + 8, x1);
+  }
+  AddScalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("avx2"))) void SubAvx2(float* dst, const float* src,
+                                              long n) {
+  long i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m256 x0 = _mm256_sub_ps(_mm256_loadu_ps(dst + i),
+                              _mm256_loadu_ps(src + i));
+    __m256 x1 = _mm256_sub_ps(_mm256_loadu_ps(dst + i + 8),
+                              _mm256_loadu_ps(src + i + 8));
+    _mm256_storeu_ps(dst + i, x0);
+    _mm256_storeu_ps(dst + i + 8, x1);
+  }
+  SubScalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("avx2"))) void ScaleAvx2(float* dst, float num,
+                                                long n) {
+  __m256 k = _mm256_set1_ps(num);
+  long i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m256 x0 = _mm256_mul_ps(_mm256_loadu_ps(dst + i), k);
+    __m256 x1 = _mm256_mul_ps(_mm256_loadu_ps(dst + i + 8), k);
+    _mm256_storeu_ps(dst + i, x0);
+    _mm256_storeu_ps(dst + i + 8, x1);
+  }
+  ScaleScalar(dst + i, num, n - i);
+}
+
+__attribute__((target("avx2"))) bool EqualAvx2(const float* a, const float* b,
+                                                long n, float eps) {
+  __m256 sign = _mm256_set1_ps(-0.0f);
+  __m256 limit = _mm256_set1_ps(eps);
+  long i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256 diff = _mm256_sub_ps(_mm256_loadu_ps(a + i),
+                                _mm256_loadu_ps(b + i));
+    __m256 gt = _mm256_cmp_ps(_mm256_andnot_ps(sign, diff), limit, _CMP_GT_OQ);
+    if (_mm256_movemask_ps(gt)) return false;
+  }
+  return EqualScalar(a + i, b + i, n - i, eps);
+}
+
+__attribute__((target("avx512f"))) void AddAvx512(float* dst,
+                                                   const float* src, long n) {
+  long i = 0;
+  for (; i + 16 <= n; i += 16) {
+    _mm512_storeu_ps(dst + i, _mm512_add_ps(_mm512_loadu_ps(dst + i),
+                                            _mm512_loadu_ps(src + i)));
+  }
+  if (i < n) {
+    __mmask16 tail = static_cast<__mmask16>((1u << (n - i)) - 1);
+    _mm512_mask_storeu_ps(
+        dst + i, tail,
+        _mm512_add_ps(_mm512_maskz_loadu_ps(tail, dst + i),
+                      _mm512_maskz_loadu_ps(tail, src + i)));
+  }
+}
+
+__attribute__((target("avx512f"))) void SubAvx512(float* dst,
+                                                   const float* src, long n) {
+  long i = 0;
+  for (; i + 16 <= n; i += 16) {
+    _mm512_storeu_ps(dst + i, _mm512_sub_ps(_mm512_loadu_ps(dst + i),
+                                            _mm512_loadu_ps(src + i)));
+  }
+  if (i < n) {
+    __mmask16 tail = static_cast<__mmask16>((1u << (n - i)) - 1);
+    _mm512_mask_storeu_ps(
+        dst + i, tail,
+        _mm512_sub_ps(_mm512_maskz_loadu_ps(tail, dst + i),
+                      _mm512_maskz_loadu_ps(tail, src + i)));
+  }
+}
+
+__attribute__((target("avx512f"))) void ScaleAvx512(float* dst, float num,
+                                                     long n) {
+  __m512 k = _mm512_set1_ps(num);
+  long i = 0;
+  for (; i + 16 <= n; i += 16) {
+    _mm512_storeu_ps(dst + i, _mm512_mul_ps(_mm512_loadu_ps(dst + i), k));
+  }
+  if (i < n) {
+    __mmask16 tail = static_cast<__mmask16>((1u << (n - i)) - 1);
+    _mm512_mask_storeu_ps(
+        dst + i, tail, _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, dst + i), k));
+  }
+}
+
+__attribute__((target("avx512f"))) bool EqualAvx512(const float* a,
+                                                     const float* b, long n,
+                                                     float eps) {
+  __m512 limit = _mm512_set1_ps(eps);
+  long i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m512 diff = _mm512_sub_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i));
+    if (_mm512_cmp_ps_mask(_mm512_abs_ps(diff), limit, _CMP_GT_OQ))
+      return false;
+  }
+  return EqualScalar(a + i, b + i, n - i, eps);
+}
+
+#endif  // S21_SIMD_X86
+
+// std::complex<double> is laid out as two doubles, so sums, differences and
+// scaling by a real number run through the double kernels over 2n values.
+template <void (*kKernel)(double*, const double*, long)>
+void Interleaved(std::complex<double>* dst, const std::complex<double>* src,
+                 long n) {
+  kKernel(reinterpret_cast<double*>(dst), reinterpret_cast<const double*>(src),
+          2 * n);
+}
+
+template <void (*kScale)(double*, double, long)>
+void InterleavedScale(std::complex<double>* dst, std::complex<double> num,
+                      long n) {
+  if (num.imag() == 0) {
+    kScale(reinterpret_cast<double*>(dst), num.real(), 2 * n);
+  } else {
+    ScaleScalar(dst, num, n);
+  }
+}
+
+// Tables for S21SimdLevel kScalar, kSse2, kAvx2 and kAvx512 in order; only
+// the scalar one is built off x86.
+const S21SimdKernelsT<double> kDoubleKernels[] = {
+    {AddScalar<double>, SubScalar<double>, ScaleScalar<double>,
+     EqualScalar<double>, TransposeScalar<double>},
+#ifdef S21_SIMD_X86
+    {AddSse2, SubSse2, ScaleSse2, EqualSse2, TransposeSse2},
+    {AddAvx2, SubAvx2, ScaleAvx2, EqualAvx2, TransposeAvx2},
+    // AVX-512 reuses the AVX2 4x4 tile kernel for transposes.
+    {AddAvx512, SubAvx512, ScaleAvx512, EqualAvx512, TransposeAvx2},
+#endif
+};
+
+const S21SimdKernelsT<float> kFloatKernels[] = {
+    {AddScalar<float>, SubScalar<float>, ScaleScalar<float>,
+     EqualScalar<float>, TransposeScalar<float>},
+#ifdef S21_SIMD_X86
+    // Wider levels reuse the SSE 4x4 tile kernel for transposes.
+    {AddSse2, SubSse2, ScaleSse2, EqualSse2, TransposeSse2},
+    {AddAvx2, SubAvx2, ScaleAvx2, EqualAvx2, TransposeSse2},
+    {AddAvx512, SubAvx512, ScaleAvx512, EqualAvx512, TransposeSse2},
+#endif
+};
+
+// x87 long doubles have no vector instructions: every level is scalar.
+const S21SimdKernelsT<long double> kLongDoubleScalar = {
+    AddScalar<long double>, SubScalar<long double>, ScaleScalar<long double>,
+    EqualScalar<long double>, TransposeScalar<long double>};
+const S21SimdKernelsT<long double> kLongDoubleKernels[] = {
+    kLongDoubleScalar, kLongDoubleScalar, kLongDoubleScalar,
+    kLongDoubleScalar};
+
+using Complex = std::complex<double>;
+
+const S21SimdKernelsT<Complex> kComplexKernels[] = {
+    {AddScalar<Complex>, SubScalar<Complex>, ScaleScalar<Complex>,
+     EqualScalar<Complex>, TransposeScalar<Complex>},
+#ifdef S21_SIMD_X86
+    {Interleaved<AddSse2>, Interleaved<SubSse2>, InterleavedScale<ScaleSse2>,
+     EqualScalar<Complex>, TransposeScalar<Complex>},
+    {Interleaved<AddAvx2>, Interleaved<SubAvx2>, InterleavedScale<ScaleAvx2>,
+     EqualScalar<Complex>, TransposeScalar<Complex>},
+    {Interleaved<AddAvx512>, Interleaved<SubAvx512>,
+     InterleavedScale<ScaleAvx512>, EqualScalar<Complex>,
+     TransposeScalar<Complex>},
+#endif
+};
+
+const S21SimdKernelsT<double>* Levels(const double*) noexcept {
+  return kDoubleKernels;
+}
+
+const S21SimdKernelsT<float>* Levels(const float*) noexcept {
+  return kFloatKernels;
+}
+
+const S21SimdKernelsT<long double>* Levels(const long double*) noexcept {
+  return kLongDoubleKernels;
+}
+
+const S21SimdKernelsT<Complex>* Levels(const Complex*) noexcept {
+  return kComplexKernels;
+}
+
+}  // namespace
+
+S21SimdLevel S21SimdDetect() noexcept {
+#ifdef S21_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) return S21SimdLevel::kAvx512;
+  if (__builtin_cpu_supports("avx2")) return S21SimdLevel::kAvx2;
+  if (__builtin_cpu_supports("sse2")) return S21SimdLevel::kSse2;
+#endif
+  return S21SimdLevel::kScalar;
+}
+
+template <typename T>
+const S21SimdKernelsT<T>& S21SimdKernelsFor(S21SimdLevel level) noexcept {
+#ifdef S21_SIMD_X86
+  return Levels(static_cast<const T*>(nullptr))[static_cast<int>(level)];
+#else
+  (void)level;
+  return Levels(static_cast<const T*>(nullptr))[0];
+#endif
+}
+
+template <typename T>
+const S21SimdKernelsT<T>& S21Simd() noexcept {
+  static const S21SimdKernelsT<T>& kernels =
+      S21SimdKernelsFor<T>(S21SimdDetect());
+  return kernels;
+}
+
+template const S21SimdKernelsT<float>& S21SimdKernelsFor(S21SimdLevel) noexcept;
+template const S21SimdKernelsT<double>& S21SimdKernelsFor(
+    S21SimdLevel) noexcept;
+template const S21SimdKernelsT<long double>& S21SimdKernelsFor(
+    S21SimdLevel) noexcept;
+template const S21SimdKernelsT<Complex>& S21SimdKernelsFor(
+    S21SimdLevel) noexcept;
+
+template const S21SimdKernelsT<float>& S21Simd() noexcept;
+template const S21SimdKernelsT<double>& S21Simd() noexcept;
+template const S21SimdKernelsT<long double>& S21Simd() noexcept;
+template const S21SimdKernelsT<Complex>& S21Simd() noexcept;
@@ -0,0 +1,34 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_S21_SIMD_H_
+#define CPP1_S21_MATRIXPLUS_1_S21_SIMD_H_
+
+#include "s21_scalar_traits.h"
+
+enum class S21SimdLevel { kScalar, kSse2, kAvx2, kAvx512 };
+
+// Kernels over contiguous buffers of n elements of T and small strided
+// tiles. double and float have vector kernels at every level; complex<double>
+// adds and subtracts as interleaved doubles; long double is scalar only.
+template <typename T>
+struct S21SimdKernelsT {
+  using real_type = typename S21ScalarTraits<T>::real_type;
+
+  void (*add)(T* dst, const T* src, long n);
+  void (*sub)(T* dst, const T* src, long n);
+  void (*scale)(T* dst, T num, long n);
+  // True when no |a[i] - b[i]| is greater than eps.
+  bool (*equal)(const T* a, const T* b, long n, real_type eps);
+  // Writes the transpose of the rows x cols tile a to b, in register-sized
+  // blocks where the level allows.
+  void (*transpose)(const T* a, int rows, int cols, int lda, T* b, int ldb);
+};
+
+using S21SimdKernels = S21SimdKernelsT<double>;
+
+S21SimdLevel S21SimdDetect() noexcept;
+template <typename T = double>
+const S21SimdKernelsT<T>& S21SimdKernelsFor(S21SimdLevel level) noexcept;
+// Kernels for the best level this CPU supports, chosen on first use.
+template <typename T = double>
+const S21SimdKernelsT<T>& S21Simd() noexcept;
+
+#endif  // CPP1_S21_MATRIXPLUS_1_S21_SIMD_H_
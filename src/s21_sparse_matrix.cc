@@ -0,0 +1,507 @@
+#include "s21_sparse_matrix.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+
+namespace {
+
+// Regroups the entries of a compressed matrix by their inner index, turning
+// CSR arrays into CSC ones and back. Outer slices are walked in order, so
+// every regrouped slice comes out sorted.
+template <typename T>
+void Regroup(int outer, int inner, const std::vector<int>& offsets,
+             const std::vector<int>& indices, const std::vector<T>& values,
+             std::vector<int>& res_offsets, std::vector<int>& res_indices,
+             std::vector<T>& res_values) {
+  res_offsets.assign(inner + 1, 0);
+  for (int index : indices) ++res_offsets[index + 1];
+  for (int k = 0; k < inner; ++k) res_offsets[k + 1] += res_offsets[k];
+
+  res_indices.resize(indices.size());
+  res_values.resize(values.size());
+  std::vector<int> next(res_offsets.begin(), res_offsets.end() - 1);
+  for (int o = 0; o < outer; ++o) {
+    for (int p = offsets[o]; p < offsets[o + 1]; ++p) {
+      int q = next[indices[p]]++;
+      res_indices[q] = o;
+      res_values[q] = values[p];
+    }
+  }
+}
+
+// Gustavson's product of compressed a (outer x shared) and b (shared x
+// inner) with the same orientation: each outer slice of the result gathers
+// scaled slices of b in a dense accumulator, and only the touched inner
+// indices are then sorted and emitted.
+template <typename T>
+void Gustavson(int outer, int inner, const std::vector<int>& a_offsets,
+               const std::vector<int>& a_indices,
+               const std::vector<T>& a_values,
+               const std::vector<int>& b_offsets,
+               const std::vector<int>& b_indices,
+               const std::vector<T>& b_values, std::vector<int>& res_offsets,
+               std::vector<int>& res_indices, std::vector<T>& res_values) {
+  std::vector<T> acc(inner, T(0));
+  std::vector<int> marker(inner, -1);
+  std::vector<int> touched;
+  res_offsets.assign(outer + 1, 0);
+  res_indices.clear();
+  res_values.clear();
+
+  for (int o = 0; o < outer; ++o) {
+    touched.clear();
+    for (int p = a_offsets[o]; p < a_offsets[o + 1]; ++p) {
+      int k = a_indices[p];
+      T a = a_values[p];
+      for (int q = b_offsets[k]; q < b_offsets[k + 1]; ++q) {
+        int j = b_indices[q];
+        if (marker[j] != o) {
+          marker[j] = o;
+          acc[j] = T(0);
+          touched.push_back(j);
+        }
+        acc[j] += a * b_values[q];
+      }
+    }
+    std::sort(touched.begin(), touched.end());
+    for (int j : touched) {
+      res_indices.push_back(j);
+      res_values.push_back(acc[j]);
+    }
+    res_offsets[o + 1] = static_cast<int>(res_indices.size());
+  }
+}
+
+}  // namespace
+
+template <typename T>
+S21SparseMatrixT<T>::S21SparseMatrixT() noexcept
+    : rows_(0), cols_(0), format_(Format::kCsr), offsets_(1, 0) {}
+
+template <typename T>
+S21SparseMatrixT<T>::S21SparseMatrixT(int rows, int cols, Format format)
+    : rows_(rows), cols_(cols), format_(format) {
+  if (rows_ < 1 || cols_ < 1)
+    throw std::invalid_argument(
+        "Incorrect input, matrix should have positive size");
+
+  offsets_.assign(Outer() + 1, 0);
+}
+
+template <typename T>
+S21SparseMatrixT<T>::S21SparseMatrixT(int rows, int cols, Format format,
+                                      std::vector<int> offsets,
+                                      std::vector<int> indices,
+                                      std::vector<T> values) noexcept
+    : rows_(rows),
+      cols_(cols),
+      format_(format),
+      offsets_(std::move(offsets)),
+      indices_(std::move(indices)),
+      values_(std::move(values)) {}
+
+template <typename T>
+S21SparseMatrixT<T>::S21SparseMatrixT(const S21MatrixViewT<T>& dense,
+                                      Format format, real_type drop)
+    : S21SparseMatrixT(dense.GetRows(), dense.GetCols()) {
+  for (int i = 0; i < rows_; ++i) {
+    const T* row_ = dense.RowPtr(i);
+    for (int j = 0; j < cols_; ++j) {
+      if (std::abs(row_[j]) > drop) {
+        indices_.push_back(j);
+        values_.push_back(row_[j]);
+      }
+    }
+    offsets_[i + 1] = NonZeros();
+  }
+  if (format == Format::kCsc) *this = ToFormat(format);
+}
+
+template <typename T>
+S21SparseMatrixT<T> S21SparseMatrixT<T>::FromTriplets(
+    int rows, int cols, std::vector<Triplet> entries, Format format) {
+  S21SparseMatrixT res_(rows, cols, format);
+  for (const Triplet& entry : entries) {
+    if (entry.row < 0 || entry.row >= rows || entry.col < 0 ||
+        entry.col >= cols)
+      throw std::out_of_range("Incorrect input, index is out of range");
+  }
+
+  bool csr = format == Format::kCsr;
+  auto key = [csr](const Triplet& entry) {
+    return csr ? std::make_pair(entry.row, entry.col)
+               : std::make_pair(entry.col, entry.row);
+  };
+  std::sort(entries.begin(), entries.end(),
+            [&key](const Triplet& a, const Triplet& b) {
+              return key(a) < key(b);
+            });
+
+  for (std::size_t p = 0; p < entries.size(); ++p) {
+    auto position = key(entries[p]);
+    if (p > 0 && position == key(entries[p - 1])) {
+      res_.values_.back() += entries[p].value;
+    } else {
+      ++res_.offsets_[position.first + 1];
+      res_.indices_.push_back(position.second);
+      res_.values_.push_back(entries[p].value);
+    }
+  }
+  for (int o = 0; o < res_.Outer(); ++o)
+    res_.offsets_[o + 1] += res_.offsets_[o];
+
+  return res_;
+}
+
+template <typename T>
+T S21SparseMatrixT<T>::operator()(int i, int j) const {
+  if (i >= rows_ || j >= cols_ || i < 0 || j < 0)
+    throw std::out_of_range("Incorrect input, index is out of range");
+
+  int outer = format_ == Format::kCsr ? i : j;
+  int inner = format_ == Format::kCsr ? j : i;
+  auto first = indices_.begin() + offsets_[outer];
+  auto last = indices_.begin() + offsets_[outer + 1];
+  auto found = std::lower_bound(first, last, inner);
+
+  return found != last && *found == inner ? values_[found - indices_.begin()]
+                                          : T(0);
+}
+
+template <typename T>
+S21MatrixT<T> S21SparseMatrixT<T>::ToDense() const {
+  if (rows_ == 0) return S21MatrixT<T>();
+
+  S21MatrixT<T> res_(rows_, cols_);
+  AddTo(res_);
+
+  return res_;
+}
+
+template <typename T>
+S21SparseMatrixT<T> S21SparseMatrixT<T>::ToFormat(Format format) const {
+  if (format == format_) return *this;
+
+  S21SparseMatrixT res_(rows_, cols_, format, {}, {}, {});
+  Regroup(Outer(), Inner(), offsets_, indices_, values_, res_.offsets_,
+          res_.indices_, res_.values_);
+
+  return res_;
+}
+
+template <typename T>
+S21SparseMatrixT<T> S21SparseMatrixT<T>::Transpose() const {
+  // The CSC arrays of A are the CSR arrays of its transpose and vice versa.
+  Format other = format_ == Format::kCsr ? Format::kCsc : Format::kCsr;
+  S21SparseMatrixT res_ = ToFormat(other);
+  std::swap(res_.rows_, res_.cols_);
+  res_.format_ = format_;
+
+  return res_;
+}
+
+template <typename T>
+void S21SparseMatrixT<T>::Prune(real_type drop) {
+  int kept = 0;
+  for (int o = 0, p = 0; o < Outer(); ++o) {
+    for (; p < offsets_[o + 1]; ++p) {
+      if (std::abs(values_[p]) > drop) {
+        indices_[kept] = indices_[p];
+        values_[kept++] = values_[p];
+      }
+    }
+    offsets_[o + 1] = kept;
+  }
+  indices_.resize(kept);
+  values_.resize(kept);
+}
+
+template <typename T>
+void S21SparseMatrixT<T>::Multiply(const T* x, T* y) const {
+  if (format_ == Format::kCsr) {
+    for (int i = 0; i < rows_; ++i) {
+      T sum = T(0);
+      for (int p = offsets_[i]; p < offsets_[i + 1]; ++p)
+        sum += values_[p] * x[indices_[p]];
+      y[i] = sum;
+    }
+  } else {
+    std::fill(y, y + rows_, T(0));
+    for (int j = 0; j < cols_; ++j) {
+      T xj = x[j];
+      for (int p = offsets_[j]; p < offsets_[j + 1]; ++p)
+        y[indices_[p]] += values_[p] * xj;
+    }
+  }
+}
+
+template <typename T>
+std::vector<T> S21SparseMatrixT<T>::Multiply(const std::vector<T>& x) const {
+  if (static_cast<int>(x.size()) != cols_)
+    throw std::logic_error("Inconsistency in the number of columns and rows");
+
+  std::vector<T> res_(rows_);
+  Multiply(x.data(), res_.data());
+
+  return res_;
+}
+
+template <typename T>
+void S21SparseMatrixT<T>::AddTo(S21MatrixT<T>& dense, T alpha) const {
+  if (dense.GetRows() != rows_ || dense.GetCols() != cols_)
+    throw std::logic_error("Matrices must be of the same dimension");
+
+  bool csr = format_ == Format::kCsr;
+  for (int o = 0; o < Outer(); ++o) {
+    for (int p = offsets_[o]; p < offsets_[o + 1]; ++p) {
+      T& element = csr ? dense.Get(o, indices_[p]) : dense.Get(indices_[p], o);
+      element += alpha * values_[p];
+    }
+  }
+}
+
+template <typename T>
+void S21SparseMatrixT<T>::Merge(const S21SparseMatrixT& other, T sign) {
+  if (rows_ != other.rows_ || cols_ != other.cols_)
+    throw std::logic_error("Matrices must be of the same dimension");
+
+  const S21SparseMatrixT& rhs =
+      other.format_ == format_ ? other : other.ToFormat(format_);
+  std::vector<int> offsets(Outer() + 1, 0), indices;
+  std::vector<T> values;
+  indices.reserve(indices_.size() + rhs.indices_.size());
+  values.reserve(indices.capacity());
+
+  for (int o = 0; o < Outer(); ++o) {
+    int p = offsets_[o], q = rhs.offsets_[o];
+    int p_end = offsets_[o + 1], q_end = rhs.offsets_[o + 1];
+    while (p < p_end || q < q_end) {
+      if (q == q_end || (p < p_end && indices_[p] < rhs.indices_[q])) {
+        indices.push_back(indices_[p]);
+        values.push_back(values_[p++]);
+      } else if (p == p_end || rhs.indices_[q] < indices_[p]) {
+        indices.push_back(rhs.indices_[q]);
+        values.push_back(sign * rhs.values_[q++]);
+      } else {
+        indices.push_back(indices_[p]);
+        values.push_back(values_[p++] + sign * rhs.values_[q++]);
+      }
+    }
+    offsets[o + 1] = static_cast<int>(indices.size());
+  }
+
+  offsets_ = std::move(offsets);
+  indices_ = std::move(indices);
+  values_ = std::move(values);
+}
+
+template <typename T>
+void S21SparseMatrixT<T>::SumMatrix(const S21SparseMatrixT& other) {
+  Merge(other, T(1));
+}
+
+template <typename T>
+void S21SparseMatrixT<T>::SubMatrix(const S21SparseMatrixT& other) {
+  Merge(other, T(-1));
+}
+
+template <typename T>
+void S21SparseMatrixT<T>::MulMatrix(const S21SparseMatrixT& other) {
+  *this = S21Multiply(*this, other);
+}
+
+template <typename T>
+void S21SparseMatrixT<T>::MulNumber(const T num) noexcept {
+  for (T& value : values_) value *= num;
+}
+
+template <typename T>
+bool S21SparseMatrixT<T>::EqMatrix(
+    const S21SparseMatrixT& other) const noexcept {
+  if (rows_ != other.rows_ || cols_ != other.cols_) return false;
+
+  // Comparing A - B against zero would allocate; walk both in one format
+  // instead, regrouping other only when the formats differ.
+  if (other.format_ != format_) {
+    try {
+      return EqMatrix(other.ToFormat(format_));
+    } catch (...) {
+      return false;
+    }
+  }
+
+  auto eps = S21MatrixT<T>::GetEqTolerance();
+  for (int o = 0; o < Outer(); ++o) {
+    int p = offsets_[o], q = other.offsets_[o];
+    int p_end = offsets_[o + 1], q_end = other.offsets_[o + 1];
+    while (p < p_end || q < q_end) {
+      T difference;
+      if (q == q_end || (p < p_end && indices_[p] < other.indices_[q])) {
+        difference = values_[p++];
+      } else if (p == p_end || other.indices_[q] < indices_[p]) {
+        difference = other.values_[q++];
+      } else {
+        difference = values_[p++] - other.values_[q++];
+      }
+      if (std::abs(difference) > eps) return false;
+    }
+  }
+
+  return true;
+}
+
+template <typename T>
+S21SparseMatrixT<T>& S21SparseMatrixT<T>::operator+=(
+    const S21SparseMatrixT& other) {
+  SumMatrix(other);
+  return *this;
+}
+
+template <typename T>
+S21SparseMatrixT<T>& S21SparseMatrixT<T>::operator-=(
+    const S21SparseMatrixT& other) {
+  SubMatrix(other);
+  return *this;
+}
+
+template <typename T>
+S21SparseMatrixT<T>& S21SparseMatrixT<T>::operator*=(
+    const S21SparseMatrixT& other) {
+  MulMatrix(other);
+  return *this;
+}
+
+template <typename T>
+S21SparseMatrixT<T>& S21SparseMatrixT<T>::operator*=(const T num) noexcept {
+  MulNumber(num);
+  return *this;
+}
+
+template <typename T>
+bool S21SparseMatrixT<T>::operator==(
+    const S21SparseMatrixT& other) const noexcept {
+  return EqMatrix(other);
+}
+
+template <typename T>
+S21MatrixT<T> S21Multiply(const S21SparseMatrixT<T>& lhs,
+                          const S21MatrixViewT<T>& rhs) {
+  if (lhs.GetCols() != rhs.GetRows())
+    throw std::logic_error("Inconsistency in the number of columns and rows");
+
+  // Each stored a(i, k) adds a(i, k) times row k of rhs to row i of the
+  // result, so both formats stream whole rows.
+  S21MatrixT<T> res_(lhs.GetRows(), rhs.GetCols());
+  const std::vector<int>& offsets = lhs.Offsets();
+  const std::vector<int>& indices = lhs.Indices();
+  const std::vector<T>& values = lhs.Values();
+  bool csr = lhs.GetFormat() == S21SparseMatrixT<T>::Format::kCsr;
+  int outer = csr ? lhs.GetRows() : lhs.GetCols(), n = rhs.GetCols();
+  for (int o = 0; o < outer; ++o) {
+    for (int p = offsets[o]; p < offsets[o + 1]; ++p) {
+      T* dst = res_.RowPtr(csr ? o : indices[p]);
+      const T* src = rhs.RowPtr(csr ? indices[p] : o);
+      T a = values[p];
+      for (int j = 0; j < n; ++j) dst[j] += a * src[j];
+    }
+  }
+
+  return res_;
+}
+
+template <typename T>
+S21MatrixT<T> S21Multiply(const S21MatrixViewT<T>& lhs,
+                          const S21SparseMatrixT<T>& rhs) {
+  if (lhs.GetCols() != rhs.GetRows())
+    throw std::logic_error("Inconsistency in the number of columns and rows");
+
+  // Row i of the result is row i of lhs times rhs: a sparse row-vector
+  // product per row, scattering in CSR and gathering in CSC.
+  S21MatrixT<T> res_(lhs.GetRows(), rhs.GetCols());
+  const std::vector<int>& offsets = rhs.Offsets();
+  const std::vector<int>& indices = rhs.Indices();
+  const std::vector<T>& values = rhs.Values();
+  bool csr = rhs.GetFormat() == S21SparseMatrixT<T>::Format::kCsr;
+  for (int i = 0; i < lhs.GetRows(); ++i) {
+    const T* src = lhs.RowPtr(i);
+    T* dst = res_.RowPtr(i);
+    if (csr) {
+      for (int k = 0; k < rhs.GetRows(); ++k) {
+        T a = src[k];
+        for (int p = offsets[k]; p < offsets[k + 1]; ++p)
+          dst[indices[p]] += a * values[p];
+      }
+    } else {
+      for (int j = 0; j < rhs.GetCols(); ++j) {
+        T sum = T(0);
+        for (int p = offsets[j]; p < offsets[j + 1]; ++p)
+          sum += src[indices[p]] * values[p];
+        dst[j] = sum;
+      }
+    }
+  }
+
+  return res_;
+}
+
+template <typename T>
+S21SparseMatrixT<T> S21Multiply(const S21SparseMatrixT<T>& lhs,
+                                const S21SparseMatrixT<T>& rhs) {
+  using Format = typename S21SparseMatrixT<T>::Format;
+  if (lhs.GetCols() != rhs.GetRows())
+    throw std::logic_error("Inconsistency in the number of columns and rows");
+
+  // In CSC, C = A * B is computed as C^T = B^T * A^T over the same arrays.
+  Format format = lhs.GetFormat();
+  const S21SparseMatrixT<T>& other =
+      rhs.GetFormat() == format ? rhs : rhs.ToFormat(format);
+  bool csr = format == Format::kCsr;
+  const S21SparseMatrixT<T>& a = csr ? lhs : other;
+  const S21SparseMatrixT<T>& b = csr ? other : lhs;
+  int outer = csr ? lhs.GetRows() : rhs.GetCols();
+  int inner = csr ? rhs.GetCols() : lhs.GetRows();
+
+  std::vector<int> offsets, indices;
+  std::vector<T> values;
+  Gustavson(outer, inner, a.Offsets(), a.Indices(), a.Values(), b.Offsets(),
+            b.Indices(), b.Values(), offsets, indices, values);
+
+  return S21SparseMatrixT<T>(lhs.GetRows(), rhs.GetCols(), format,
+                             std::move(offsets), std::move(indices),
+                             std::move(values));
+}
+
+template class S21SparseMatrixT<float>;
+template class S21SparseMatrixT<double>;
+template class S21SparseMatrixT<long double>;
+template class S21SparseMatrixT<std::complex<double>>;
+
+template S21MatrixT<float> S21Multiply(const S21SparseMatrixT<float>&,
+                                       const S21MatrixViewT<float>&);
+template S21MatrixT<float> S21Multiply(const S21MatrixViewT<float>&,
+                                       const S21SparseMatrixT<float>&);
+template S21SparseMatrixT<float> S21Multiply(const S21SparseMatrixT<float>&,
+                                             const S21SparseMatrixT<float>&);
+template S21MatrixT<double> S21Multiply(const S21SparseMatrixT<double>&,
+                                        const S21MatrixViewT<double>&);
+template S21MatrixT<double> S21Multiply(const S21MatrixViewT<double>&,
+                                        const S21SparseMatrixT<double>&);
+template S21SparseMatrixT<double> S21Multiply(const S21SparseMatrixT<double>&,
+                                              const S21SparseMatrixT<double>&);
+template S21MatrixT<long double> S21Multiply(
+    const S21SparseMatrixT<long double>&, const S21MatrixViewT<long double>&);
+template S21MatrixT<long double> S21Multiply(
+    const S21MatrixViewT<long double>&, const S21SparseMatrixT<long double>&);
+template S21SparseMatrixT<long double> S21Multiply(
+    const S21SparseMatrixT<long double>&, const S21SparseMatrixT<long double>&);
+template S21MatrixT<std::complex<double>> S21Multiply(
+    const S21SparseMatrixT<std::complex<double>>&,
+    const S21MatrixViewT<std::complex<double>>&);
+template S21MatrixT<std::complex<double>> S21Multiply(
+    const S21MatrixViewT<std::complex<double>>&,
+    const S21SparseMatrixT<std::complex<double>>&);
+template S21SparseMatrixT<std::complex<double>> S21Multiply(
+    const S21SparseMatrixT<std::complex<double>>&,
+    const S21SparseMatrixT<std::complex<double>>&);
@@ -0,0 +1,214 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_S21_SPARSE_MATRIX_H_
+#define CPP1_S21_MATRIXPLUS_1_S21_SPARSE_MATRIX_H_
+
+#include <utility>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// Compressed sparse matrix of T, storing only its nonzero entries. In CSR
+// format the entries of row i are Values()[Offsets()[i]..Offsets()[i + 1])
+// with their columns in Indices(); CSC is the same by columns. Indices are
+// sorted and unique within each row (column), so memory and the cost of
+// products grow with the number of entries rather than rows * cols.
+// Entries are structural: sums may leave exact zeros until Prune().
+template <typename T>
+class S21SparseMatrixT {
+ public:
+  using value_type = T;
+  using real_type = typename S21ScalarTraits<T>::real_type;
+
+  enum class Format { kCsr, kCsc };
+
+  struct Triplet {
+    int row, col;
+    T value;
+  };
+
+  S21SparseMatrixT() noexcept;
+  // rows x cols of zeros.
+  S21SparseMatrixT(int rows, int cols, Format format = Format::kCsr);
+  // The entries of dense whose magnitude exceeds drop.
+  explicit S21SparseMatrixT(const S21MatrixViewT<T>& dense,
+                            Format format = Format::kCsr, real_type drop = 0);
+  // Entries may come in any order; repeated positions are summed.
+  static S21SparseMatrixT FromTriplets(int rows, int cols,
+                                       std::vector<Triplet> entries,
+                                       Format format = Format::kCsr);
+
+  int GetRows() const noexcept { return rows_; }
+  int GetCols() const noexcept { return cols_; }
+  Format GetFormat() const noexcept { return format_; }
+  int NonZeros() const noexcept { return static_cast<int>(values_.size()); }
+  const std::vector<int>& Offsets() const noexcept { return offsets_; }
+  const std::vector<int>& Indices() const noexcept { return indices_; }
+  const std::vector<T>& Values() const noexcept { return values_; }
+
+  // Element (i, j), found by binary search within its row (column).
+  T operator()(int i, int j) const;
+
+  S21MatrixT<T> ToDense() const;
+  explicit operator S21MatrixT<T>() const { return ToDense(); }
+  // The same matrix in format, by a counting sort in O(nnz + rows + cols).
+  S21SparseMatrixT ToFormat(Format format) const;
+  S21SparseMatrixT Transpose() const;
+  // Drops the entries whose magnitude is at most drop.
+  void Prune(real_type drop = 0);
+
+  // y = A * x, where x holds GetCols() elements and y GetRows().
+  void Multiply(const T* x, T* y) const;
+  std::vector<T> Multiply(const std::vector<T>& x) const;
+  // dense += alpha * A.
+  void AddTo(S21MatrixT<T>& dense, T alpha = T(1)) const;
+
+  void SumMatrix(const S21SparseMatrixT& other);
+  void SubMatrix(const S21SparseMatrixT& other);
+  void MulMatrix(const S21SparseMatrixT& other);
+  void MulNumber(const T num) noexcept;
+  // Positions stored in only one of the matrices compare against zero.
+  bool EqMatrix(const S21SparseMatrixT& other) const noexcept;
+
+  S21SparseMatrixT& operator+=(const S21SparseMatrixT& other);
+  S21SparseMatrixT& operator-=(const S21SparseMatrixT& other);
+  S21SparseMatrixT& operator*=(const S21SparseMatrixT& other);
+  S21SparseMatrixT& operator*=(const T num) noexcept;
+  bool operator==(const S21SparseMatrixT& other) const noexcept;
+
+ private:
+  template <typename U>
+  friend S21SparseMatrixT<U> S21Multiply(const S21SparseMatrixT<U>& lhs,
+                                         const S21SparseMatrixT<U>& rhs);
+
+  S21SparseMatrixT(int rows, int cols, Format format,
+                   std::vector<int> offsets, std::vector<int> indices,
+                   std::vector<T> values) noexcept;
+
+  // Length of the compressed dimension and of the other one.
+  int Outer() const noexcept {
+    return format_ == Format::kCsr ? rows_ : cols_;
+  }
+  int Inner() const noexcept {
+    return format_ == Format::kCsr ? cols_ : rows_;
+  }
+  // Adds or subtracts other, entry by entry, after matching its format.
+  void Merge(const S21SparseMatrixT& other, T sign);
+
+  int rows_, cols_;
+  Format format_;
+  std::vector<int> offsets_;
+  std::vector<int> indices_;
+  std::vector<T> values_;
+};
+
+using S21SparseMatrix = S21SparseMatrixT<double>;
+
+// Products with a sparse operand; each reads only the stored entries. As
+// with the dense S21Multiply, callers passing matrices name T.
+template <typename T>
+S21MatrixT<T> S21Multiply(const S21SparseMatrixT<T>& lhs,
+                          const S21MatrixViewT<T>& rhs);
+template <typename T>
+S21MatrixT<T> S21Multiply(const S21MatrixViewT<T>& lhs,
+                          const S21SparseMatrixT<T>& rhs);
+// Gustavson's row-by-row product; the result has lhs's format.
+template <typename T>
+S21SparseMatrixT<T> S21Multiply(const S21SparseMatrixT<T>& lhs,
+                                const S21SparseMatrixT<T>& rhs);
+
+// Mixed operators: sparse with sparse stays sparse, anything with a dense
+// matrix or expression is dense.
+template <typename T>
+S21SparseMatrixT<T> operator+(S21SparseMatrixT<T> lhs,
+                              const S21SparseMatrixT<T>& rhs) {
+  lhs.SumMatrix(rhs);
+  return lhs;
+}
+
+template <typename T>
+S21SparseMatrixT<T> operator-(S21SparseMatrixT<T> lhs,
+                              const S21SparseMatrixT<T>& rhs) {
+  lhs.SubMatrix(rhs);
+  return lhs;
+}
+
+template <typename T>
+S21SparseMatrixT<T> operator*(const S21SparseMatrixT<T>& lhs,
+                              const S21SparseMatrixT<T>& rhs) {
+  return S21Multiply(lhs, rhs);
+}
+
+template <typename T>
+S21SparseMatrixT<T> operator*(
+    S21SparseMatrixT<T> matrix,
+    const typename S21SparseMatrixT<T>::value_type num) {
+  matrix.MulNumber(num);
+  return matrix;
+}
+
+template <typename T>
+S21SparseMatrixT<T> operator*(
+    const typename S21SparseMatrixT<T>::value_type num,
+    S21SparseMatrixT<T> matrix) {
+  matrix.MulNumber(num);
+  return matrix;
+}
+
+template <typename T, typename E>
+S21MatrixT<T> operator*(const S21SparseMatrixT<T>& lhs,
+                        const S21MatrixExpr<E>& rhs) {
+  return S21Multiply<T>(lhs, S21Materialize(rhs.Self()));
+}
+
+template <typename E, typename T>
+S21MatrixT<T> operator*(const S21MatrixExpr<E>& lhs,
+                        const S21SparseMatrixT<T>& rhs) {
+  return S21Multiply<T>(S21Materialize(lhs.Self()), rhs);
+}
+
+template <typename T, typename E>
+S21MatrixT<T> operator+(const S21SparseMatrixT<T>& lhs,
+                        const S21MatrixExpr<E>& rhs) {
+  S21MatrixT<T> res_(rhs);
+  lhs.AddTo(res_);
+  return res_;
+}
+
+template <typename E, typename T>
+S21MatrixT<T> operator+(const S21MatrixExpr<E>& lhs,
+                        const S21SparseMatrixT<T>& rhs) {
+  S21MatrixT<T> res_(lhs);
+  rhs.AddTo(res_);
+  return res_;
+}
+
+template <typename T, typename E>
+S21MatrixT<T> operator-(const S21SparseMatrixT<T>& lhs,
+                        const S21MatrixExpr<E>& rhs) {
+  S21MatrixT<T> res_(T(-1) * rhs);
+  lhs.AddTo(res_);
+  return res_;
+}
+
+template <typename E, typename T>
+S21MatrixT<T> operator-(const S21MatrixExpr<E>& lhs,
+                        const S21SparseMatrixT<T>& rhs) {
+  S21MatrixT<T> res_(lhs);
+  rhs.AddTo(res_, T(-1));
+  return res_;
+}
+
+template <typename T>
+S21MatrixT<T>& operator+=(S21MatrixT<T>& lhs,
+                          const S21SparseMatrixT<T>& rhs) {
+  rhs.AddTo(lhs);
+  return lhs;
+}
+
+template <typename T>
+S21MatrixT<T>& operator-=(S21MatrixT<T>& lhs,
+                          const S21SparseMatrixT<T>& rhs) {
+  rhs.AddTo(lhs, T(-1));
+  return lhs;
+}
+
+#endif  // CPP1_S21_MATRIXPLUS_1_S21_SPARSE_MATRIX_H_
@@ -0,0 +1,195 @@
+#include "s21_strassen.h"
+
+#include <algorithm>
+#include <complex>
+#include <vector>
+
+#include "s21_gemm.h"
+
+namespace {
+
+int strassen_cutoff = 1024;
+
+// Leading dimension of a temporary of cols elements per row: whole 64-byte
+// lines, and one more line when rows would fall a multiple of 1 KiB apart,
+// as S21MatrixT pads its own rows.
+template <typename T>
+int Padded(int cols) noexcept {
+  constexpr int line = std::max<int>(64 / sizeof(T), 1);
+  constexpr int alias = std::max<int>(1024 / sizeof(T), 1);
+  int ld = (cols + line - 1) / line * line;
+  if (ld % alias == 0) ld += line;
+  return ld;
+}
+
+// c = a + b or a - b over m x n blocks; c may be a or b.
+template <typename T>
+void Combine(int m, int n, const T* a, int lda, const T* b, int ldb, T* c,
+             int ldc, bool subtract) {
+  for (int i = 0; i < m; ++i) {
+    const T* a_row = a + static_cast<long>(i) * lda;
+    const T* b_row = b + static_cast<long>(i) * ldb;
+    T* c_row = c + static_cast<long>(i) * ldc;
+    if (subtract) {
+      for (int j = 0; j < n; ++j) c_row[j] = a_row[j] - b_row[j];
+    } else {
+      for (int j = 0; j < n; ++j) c_row[j] = a_row[j] + b_row[j];
+    }
+  }
+}
+
+// c = c + b or c - b.
+template <typename T>
+void Accumulate(int m, int n, const T* b, int ldb, T* c, int ldc,
+                bool subtract) {
+  Combine(m, n, c, ldc, b, ldb, c, ldc, subtract);
+}
+
+template <typename T>
+void Classic(int m, int n, int k, const T* a, int lda, const T* b, int ldb,
+             T* c, int ldc) {
+  for (int i = 0; i < m; ++i) {
+    T* row = c + static_cast<long>(i) * ldc;
+    std::fill(row, row + n, T(0));
+  }
+  S21Gemm(m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+template <typename T>
+void Recurse(int m, int n, int k, const T* a, int lda, const T* b, int ldb,
+             T* c, int ldc, T* work, int cutoff);
+
+// One Winograd level on even m, n and k, with the schedule of Douglas et
+// al. (DGEFMM): the seven products land in the quadrants of C and three
+// temporaries, X (m/2 x k/2), Y (k/2 x n/2) and Z (m/2 x n/2), carved from
+// the front of work; the rest of work goes to the recursive calls.
+template <typename T>
+void Winograd(int m, int n, int k, const T* a, int lda, const T* b, int ldb,
+              T* c, int ldc, T* work, int cutoff) {
+  int m2 = m / 2, n2 = n / 2, k2 = k / 2;
+  const T *a11 = a, *a12 = a + k2, *a21 = a + static_cast<long>(m2) * lda,
+          *a22 = a21 + k2;
+  const T *b11 = b, *b12 = b + n2, *b21 = b + static_cast<long>(k2) * ldb,
+          *b22 = b21 + n2;
+  T *c11 = c, *c12 = c + n2, *c21 = c + static_cast<long>(m2) * ldc,
+    *c22 = c21 + n2;
+  int ldx = Padded<T>(k2), ldy = Padded<T>(n2), ldz = ldy;
+  T* x = work;
+  T* y = x + static_cast<long>(m2) * ldx;
+  T* z = y + static_cast<long>(k2) * ldy;
+  T* rest = z + static_cast<long>(m2) * ldz;
+
+  Combine(m2, k2, a11, lda, a21, lda, x, ldx, true);  // S3 = A11 - A21
+  Combine(k2, n2, b22, ldb, b12, ldb, y, ldy, true);  // T3 = B22 - B12
+  Recurse(m2, n2, k2, x, ldx, y, ldy, c21, ldc, rest, cutoff);  // P7
+  Combine(m2, k2, a21, lda, a22, lda, x, ldx, false);  // S1 = A21 + A22
+  Combine(k2, n2, b12, ldb, b11, ldb, y, ldy, true);  // T1 = B12 - B11
+  Recurse(m2, n2, k2, x, ldx, y, ldy, c22, ldc, rest, cutoff);  // P5
+  Accumulate(m2, k2, a11, lda, x, ldx, true);  // S2 = S1 - A11
+  Combine(k2, n2, b22, ldb, y, ldy, y, ldy, true);  // T2 = B22 - T1
+  Recurse(m2, n2, k2, x, ldx, y, ldy, c12, ldc, rest, cutoff);  // P6
+  Combine(m2, k2, a12, lda, x, ldx, x, ldx, true);  // S4 = A12 - S2
+  Recurse(m2, n2, k2, x, ldx, b22, ldb, c11, ldc, rest, cutoff);  // P3
+  Recurse(m2, n2, k2, a11, lda, b11, ldb, z, ldz, rest, cutoff);  // P1
+
+  Accumulate(m2, n2, z, ldz, c12, ldc, false);  // U2 = P1 + P6
+  Accumulate(m2, n2, c12, ldc, c21, ldc, false);  // U3 = U2 + P7
+  Accumulate(m2, n2, c22, ldc, c12, ldc, false);  // U4 = U2 + P5
+  Accumulate(m2, n2, c21, ldc, c22, ldc, false);  // U7 = U3 + P5
+  Accumulate(m2, n2, c11, ldc, c12, ldc, false);  // U5 = U4 + P3
+
+  Accumulate(k2, n2, b21, ldb, y, ldy, true);  // T4 = T2 - B21
+  Recurse(m2, n2, k2, a22, lda, y, ldy, c11, ldc, rest, cutoff);  // P4
+  Accumulate(m2, n2, c11, ldc, c21, ldc, true);  // U6 = U3 - P4
+  Recurse(m2, n2, k2, a12, lda, b21, ldb, c11, ldc, rest, cutoff);  // P2
+  Accumulate(m2, n2, z, ldz, c11, ldc, false);  // U1 = P1 + P2
+}
+
+template <typename T>
+void Recurse(int m, int n, int k, const T* a, int lda, const T* b, int ldb,
+             T* c, int ldc, T* work, int cutoff) {
+  if (cutoff < 1 || std::min({m, n, k}) < cutoff) {
+    Classic(m, n, k, a, lda, b, ldb, c, ldc);
+    return;
+  }
+
+  // Peel an odd last row of A, column of B and inner index off the even
+  // core, then add their contributions through S21Gemm.
+  int me = m & ~1, ne = n & ~1, ke = k & ~1;
+  Winograd(me, ne, ke, a, lda, b, ldb, c, ldc, work, cutoff);
+  if (ke < k) {
+    S21Gemm(me, ne, 1, a + ke, lda, b + static_cast<long>(ke) * ldb, ldb, c,
+            ldc);
+  }
+  if (ne < n) Classic(m, 1, k, a, lda, b + ne, ldb, c + ne, ldc);
+  if (me < m) {
+    Classic(1, ne, k, a + static_cast<long>(me) * lda, lda, b, ldb,
+            c + static_cast<long>(me) * ldc, ldc);
+  }
+}
+
+}  // namespace
+
+template <typename T>
+long S21StrassenWorkspace(int m, int n, int k, int cutoff) noexcept {
+  long size = 0;
+  while (cutoff > 0 && std::min({m, n, k}) >= cutoff) {
+    m /= 2;
+    n /= 2;
+    k /= 2;
+    size += static_cast<long>(m) * Padded<T>(k) +
+            static_cast<long>(k + m) * Padded<T>(n);
+  }
+
+  return size;
+}
+
+template <typename T>
+void S21Strassen(int m, int n, int k, const T* a, int lda, const T* b,
+                 int ldb, T* c, int ldc, T* work, int cutoff) {
+  if (m < 1 || n < 1) return;
+
+  Recurse(m, n, k, a, lda, b, ldb, c, ldc, work, cutoff);
+}
+
+template <typename T>
+void S21Strassen(int m, int n, int k, const T* a, int lda, const T* b,
+                 int ldb, T* c, int ldc) {
+  int cutoff = strassen_cutoff;
+  std::vector<T> work(S21StrassenWorkspace<T>(m, n, k, cutoff));
+  S21Strassen(m, n, k, a, lda, b, ldb, c, ldc, work.data(), cutoff);
+}
+
+int S21GetStrassenCutoff() noexcept { return strassen_cutoff; }
+
+void S21SetStrassenCutoff(int cutoff) noexcept {
+  strassen_cutoff = std::max(cutoff, 0);
+}
+
+template void S21Strassen(int, int, int, const float*, int, const float*, int,
+                          float*, int, float*, int);
+template void S21Strassen(int, int, int, const double*, int, const double*,
+                          int, double*, int, double*, int);
+template void S21Strassen(int, int, int, const long double*, int,
+                          const long double*, int, long double*, int,
+                          long double*, int);
+template void S21Strassen(int, int, int, const std::complex<double>*, int,
+                          const std::complex<double>*, int,
+                          std::complex<double>*, int, std::complex<double>*,
+                          int);
+
+template void S21Strassen(int, int, int, const float*, int, const float*, int,
+                          float*, int);
+template void S21Strassen(int, int, int, const double*, int, const double*,
+                          int, double*, int);
+template void S21Strassen(int, int, int, const long double*, int,
+                          const long double*, int, long double*, int);
+template void S21Strassen(int, int, int, const std::complex<double>*, int,
+                          const std::complex<double>*, int,
+                          std::complex<double>*, int);
+
+template long S21StrassenWorkspace<float>(int, int, int, int) noexcept;
+template long S21StrassenWorkspace<double>(int, int, int, int) noexcept;
+template long S21StrassenWorkspace<long double>(int, int, int, int) noexcept;
+template long S21StrassenWorkspace<std::complex<double>>(int, int, int,
+                                                         int) noexcept;
@@ -0,0 +1,32 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_S21_STRASSEN_H_
+#define CPP1_S21_MATRIXPLUS_1_S21_STRASSEN_H_
+
+// C(m x n) = A(m x k) * B(k x n) for row-major operands by Strassen-Winograd
+// recursion: 7 half-size products and 15 additions per level instead of 8
+// products. Halving stops once a dimension falls below cutoff, and the
+// leaves run on S21Gemm. An odd row, column or inner index is peeled off
+// and added back through S21Gemm, so any shape works. C is overwritten.
+//
+// work must hold S21StrassenWorkspace(m, n, k, cutoff) elements; the
+// overload without it allocates them once and uses S21GetStrassenCutoff().
+template <typename T>
+void S21Strassen(int m, int n, int k, const T* a, int lda, const T* b,
+                 int ldb, T* c, int ldc, T* work, int cutoff);
+template <typename T>
+void S21Strassen(int m, int n, int k, const T* a, int lda, const T* b,
+                 int ldb, T* c, int ldc);
+
+template <typename T>
+long S21StrassenWorkspace(int m, int n, int k, int cutoff) noexcept;
+
+// Smallest dimension at which S21Multiply, and so operator* and MulMatrix,
+// switch from S21Gemm to S21Strassen, and at which S21Strassen stops
+// halving. 1024 by default: one level there was 1.2-1.35x faster than
+// S21Gemm for double while its error stayed within 3x of the classic
+// product; each further level roughly doubles the error. 0 keeps every
+// product classic. The setting is shared by all threads and not
+// synchronized.
+int S21GetStrassenCutoff() noexcept;
+void S21SetStrassenCutoff(int cutoff) noexcept;
+
+#endif  // CPP1_S21_MATRIXPLUS_1_S21_STRASSEN_H_
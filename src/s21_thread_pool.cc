@@ -0,0 +1,132 @@
+#include "s21_thread_pool.h"
+
+#include <stdexcept>
+
+namespace {
+
+thread_local bool in_pool_task = false;
+
+int HardwareThreads() {
+  int count = static_cast<int>(std::thread::hardware_concurrency());
+  return count > 0 ? count : 1;
+}
+
+}  // namespace
+
+S21ThreadPool& S21ThreadPool::Instance() {
+  static S21ThreadPool pool;
+  return pool;
+}
+
+S21ThreadPool::S21ThreadPool()
+    : job_(nullptr),
+      tasks_(0),
+      next_task_(0),
+      busy_workers_(0),
+      generation_(0),
+      stop_(false) {
+  StartWorkers(HardwareThreads() - 1);
+}
+
+S21ThreadPool::~S21ThreadPool() { StopWorkers(); }
+
+int S21ThreadPool::GetThreadCount() const noexcept {
+  return static_cast<int>(workers_.size()) + 1;
+}
+
+void S21ThreadPool::SetThreadCount(int count) {
+  if (count < 0)
+    throw std::invalid_argument("Thread count should not be negative");
+
+  std::lock_guard<std::mutex> run_lock(run_mutex_);
+  StopWorkers();
+  StartWorkers((count == 0 ? HardwareThreads() : count) - 1);
+}
+
+void S21ThreadPool::ParallelFor(int tasks,
+                                const std::function<void(int)>& fn) {
+  if (tasks < 1) return;
+
+  if (in_pool_task || tasks == 1) {
+    for (int t = 0; t < tasks; ++t) fn(t);
+    return;
+  }
+
+  std::lock_guard<std::mutex> run_lock(run_mutex_);
+  if (workers_.empty()) {
+    for (int t = 0; t < tasks; ++t) fn(t);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    job_ = &fn;
+    tasks_ = tasks;
+    next_task_ = 0;
+    busy_workers_ = static_cast<int>(workers_.size());
+    error_ = nullptr;
+    ++generation_;
+  }
+  wake_.notify_all();
+
+  RunTasks();
+
+  std::exception_ptr error;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return busy_workers_ == 0; });
+    job_ = nullptr;
+    error = error_;
+  }
+
+  if (error) std::rethrow_exception(error);
+}
+
+void S21ThreadPool::StartWorkers(int count) {
+  for (int i = 0; i < count; ++i) {
+    workers_.emplace_back(&S21ThreadPool::WorkerLoop, this, generation_);
+  }
+}
+
+void S21ThreadPool::StopWorkers() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  for (std::thread& worker : workers_) worker.join();
+  workers_.clear();
+  stop_ = false;
+}
+
+void S21ThreadPool::WorkerLoop(unsigned long seen) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  for (;;) {
+    wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+    if (stop_) return;
+    seen = generation_;
+
+    lock.unlock();
+    RunTasks();
+    lock.lock();
+
+    if (--busy_workers_ == 0) done_.notify_one();
+  }
+}
+
+void S21ThreadPool::RunTasks() {
+  in_pool_task = true;
+  for (;;) {
+    int task = next_task_.fetch_add(1);
+    if (task >= tasks_) break;
+
+    try {
+      (*job_)(task);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!error_) error_ = std::current_exception();
+      next_task_ = tasks_;
+    }
+  }
+  in_pool_task = false;
+}
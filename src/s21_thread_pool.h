@@ -0,0 +1,53 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_S21_THREAD_POOL_H_
+#define CPP1_S21_MATRIXPLUS_1_S21_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Library-owned pool of persistent workers used by the parallel kernels.
+// The calling thread takes part in every ParallelFor, so a pool of N threads
+// keeps N - 1 workers alive.
+class S21ThreadPool {
+ public:
+  static S21ThreadPool& Instance();
+
+  S21ThreadPool(const S21ThreadPool&) = delete;
+  S21ThreadPool& operator=(const S21ThreadPool&) = delete;
+  ~S21ThreadPool();
+
+  int GetThreadCount() const noexcept;
+  // 0 selects std::thread::hardware_concurrency().
+  void SetThreadCount(int count);
+
+  // Calls fn(task) for every task in [0, tasks) and returns when all of
+  // them are finished. Nested calls from inside a task run serially.
+  void ParallelFor(int tasks, const std::function<void(int)>& fn);
+
+ private:
+  S21ThreadPool();
+
+  void StartWorkers(int count);
+  void StopWorkers();
+  void WorkerLoop(unsigned long seen);
+  void RunTasks();
+
+  std::vector<std::thread> workers_;
+  std::mutex run_mutex_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  const std::function<void(int)>* job_;
+  int tasks_;
+  std::atomic<int> next_task_;
+  int busy_workers_;
+  unsigned long generation_;
+  std::exception_ptr error_;
+  bool stop_;
+};
+
+#endif  // CPP1_S21_MATRIXPLUS_1_S21_THREAD_POOL_H_
@@ -0,0 +1,104 @@
+#include "s21_transpose.h"
+
+#include <algorithm>
+#include <complex>
+#include <vector>
+
+#include "s21_simd.h"
+
+namespace {
+
+constexpr int kTile = 32;
+
+template <typename T>
+void TransposeRecursive(const S21SimdKernelsT<T>& simd, const T* a, int rows,
+                        int cols, int lda, T* b, int ldb) {
+  if (rows <= kTile && cols <= kTile) {
+    simd.transpose(a, rows, cols, lda, b, ldb);
+  } else if (rows >= cols) {
+    int half = rows / 2;
+    TransposeRecursive(simd, a, half, cols, lda, b, ldb);
+    TransposeRecursive(simd, a + static_cast<long>(half) * lda, rows - half,
+                       cols, lda, b + half, ldb);
+  } else {
+    int half = cols / 2;
+    TransposeRecursive(simd, a, rows, half, lda, b, ldb);
+    TransposeRecursive(simd, a + half, rows, cols - half, lda,
+                       b + static_cast<long>(half) * ldb, ldb);
+  }
+}
+
+template <typename T>
+void TransposeSquareInPlace(T* a, int n, int lda) {
+  const S21SimdKernelsT<T>& simd = S21Simd<T>();
+  T tile[kTile * kTile];
+  for (int i = 0; i < n; i += kTile) {
+    int rows = std::min(kTile, n - i);
+    for (int r = i; r < i + rows; ++r) {
+      for (int c = r + 1; c < i + rows; ++c) {
+        std::swap(a[static_cast<long>(r) * lda + c],
+                  a[static_cast<long>(c) * lda + r]);
+      }
+    }
+
+    for (int j = i + kTile; j < n; j += kTile) {
+      int cols = std::min(kTile, n - j);
+      T* upper = a + static_cast<long>(i) * lda + j;
+      T* lower = a + static_cast<long>(j) * lda + i;
+      simd.transpose(upper, rows, cols, lda, tile, rows);
+      simd.transpose(lower, cols, rows, lda, upper, lda);
+      for (int r = 0; r < cols; ++r) {
+        std::copy(tile + r * rows, tile + (r + 1) * rows,
+                  lower + static_cast<long>(r) * lda);
+      }
+    }
+  }
+}
+
+template <typename T>
+void TransposeCyclesInPlace(T* a, int rows, int cols) {
+  long last = static_cast<long>(rows) * cols - 1;
+  std::vector<bool> moved(last + 1, false);
+  for (long start = 1; start < last; ++start) {
+    if (moved[start]) continue;
+
+    T value = a[start];
+    long k = start;
+    do {
+      long next = k * rows % last;
+      std::swap(a[next], value);
+      moved[next] = true;
+      k = next;
+    } while (k != start);
+  }
+}
+
+}  // namespace
+
+template <typename T>
+void S21Transpose(const T* a, int rows, int cols, int lda, T* b, int ldb) {
+  TransposeRecursive(S21Simd<T>(), a, rows, cols, lda, b, ldb);
+}
+
+template <typename T>
+void S21TransposeInPlace(T* a, int rows, int cols, int lda) {
+  if (rows < 2 || cols < 2) return;
+
+  if (rows == cols) {
+    TransposeSquareInPlace(a, rows, lda);
+  } else {
+    TransposeCyclesInPlace(a, rows, cols);
+  }
+}
+
+template void S21Transpose(const float*, int, int, int, float*, int);
+template void S21Transpose(const double*, int, int, int, double*, int);
+template void S21Transpose(const long double*, int, int, int, long double*,
+                           int);
+template void S21Transpose(const std::complex<double>*, int, int, int,
+                           std::complex<double>*, int);
+
+template void S21TransposeInPlace(float*, int, int, int);
+template void S21TransposeInPlace(double*, int, int, int);
+template void S21TransposeInPlace(long double*, int, int, int);
+template void S21TransposeInPlace(std::complex<double>*, int, int, int);
@@ -0,0 +1,17 @@
+#ifndef CPP1_S21_MATRIXPLUS_1_S21_TRANSPOSE_H_
+#define CPP1_S21_MATRIXPLUS_1_S21_TRANSPOSE_H_
+
+// Writes the transpose of the rows x cols row-major matrix a to b. The
+// larger side is halved recursively until a tile fits in L1, and tiles go
+// through the dispatched SIMD transpose kernel.
+template <typename T>
+void S21Transpose(const T* a, int rows, int cols, int lda, T* b, int ldb);
+
+// Transposes the rows x cols matrix a in place, so that it holds the
+// cols x rows result. Square matrices swap tile pairs within the leading
+// dimension lda; rectangular ones must be contiguous (lda == cols) and follow
+// the permutation cycles of the flat buffer.
+template <typename T>
+void S21TransposeInPlace(T* a, int rows, int cols, int lda);
+
+#endif  // CPP1_S21_MATRIXPLUS_1_S21_TRANSPOSE_H_
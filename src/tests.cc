@@ -1,6 +1,61 @@
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_bareiss.h"
+#include "s21_cholesky.h"
+#include "s21_fixed_matrix.h"
+#include "s21_gemm.h"
+#include "s21_lu.h"
 #include "s21_matrix_oop.h"
+#include "s21_matrix_pool.h"
+#include "s21_simd.h"
+#include "s21_sparse_matrix.h"
+#include "s21_strassen.h"
+#include "s21_thread_pool.h"
+
+namespace {
+
+std::atomic<long> array_allocations(0);
+
+// Matrix buffers requested on this thread, whether or not the pool had to
+// reach the heap for them.
+long BufferRequests() { return S21MatrixPool::Local().GetStats().requests; }
+
+template <typename L, typename R, typename = void>
+struct CanMultiply : std::false_type {};
+
+template <typename L, typename R>
+struct CanMultiply<L, R,
+                   std::void_t<decltype(std::declval<L>() * std::declval<R>())>>
+    : std::true_type {};
+
+template <typename L, typename R, typename = void>
+struct CanAdd : std::false_type {};
+
+template <typename L, typename R>
+struct CanAdd<L, R,
+              std::void_t<decltype(std::declval<L>() + std::declval<R>())>>
+    : std::true_type {};
+
+}  // namespace
+
+void* operator new[](std::size_t size) {
+  ++array_allocations;
+  if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
 
 TEST(TestMatrix, constructors) {
   S21Matrix A;
@@ -152,6 +207,75 @@ TEST(FUNCTIONS, SetCols_Less) {
   GTEST_ASSERT_EQ(test.GetCols(), 2);
 }
 
+TEST(FUNCTIONS, ShrinkInPlace) {
+  S21Matrix test(6, 20);
+  for (int i = 0; i < 6; ++i) {
+    for (int j = 0; j < 20; ++j) test(i, j) = i * 20 + j + 1;
+  }
+
+  const double* data = test.Data();
+  long before = BufferRequests();
+  test.SetRows(4);
+  test.SetCols(3);
+  test.SetCols(10);
+  test.SetRows(6);
+  ASSERT_EQ(BufferRequests(), before);
+  ASSERT_EQ(test.Data(), data);
+  ASSERT_EQ(test(3, 2), 63);
+  ASSERT_EQ(test(3, 3), 0);
+  ASSERT_EQ(test(5, 0), 0);
+
+  S21Matrix copy(test);
+  ASSERT_TRUE(copy == test);
+  test.ShrinkToFit();
+  ASSERT_EQ(test.GetRowCapacity(), 6);
+  ASSERT_EQ(test.GetStride(), 16);
+  ASSERT_TRUE(copy == test);
+
+  test.SetCols(40);
+  ASSERT_EQ(test.GetCols(), 40);
+  ASSERT_EQ(test(2, 39), 0);
+  ASSERT_EQ(test(2, 2), 43);
+}
+
+TEST(FUNCTIONS, AppendRow) {
+  S21Matrix design;
+  EXPECT_THROW(design.AppendRow(nullptr), std::logic_error);
+  design.Reserve(0, 3);
+  ASSERT_EQ(design.GetRows(), 0);
+  ASSERT_EQ(design.GetCols(), 3);
+
+  long before = BufferRequests();
+  for (int i = 0; i < 1000; ++i) {
+    double row[] = {1.0 * i, 2.0 * i, 1};
+    design.AppendRow(row);
+  }
+  ASSERT_LE(BufferRequests() - before, 10);
+  ASSERT_EQ(design.GetRows(), 1000);
+  ASSERT_GE(design.GetRowCapacity(), 1000);
+  ASSERT_EQ(design(999, 1), 1998);
+  ASSERT_EQ(design(0, 2), 1);
+
+  for (int i = design.GetRows(); i < design.GetRowCapacity(); ++i) {
+    design.AppendRow(design.RowPtr(1));
+  }
+  design.AppendRow(design.RowPtr(2));
+  ASSERT_EQ(design(design.GetRows() - 1, 1), 4);
+  ASSERT_EQ(design(design.GetRows() - 2, 0), 1);
+
+  S21Matrix reserved(2, 2);
+  reserved(1, 1) = 5;
+  reserved.Reserve(100, 30);
+  ASSERT_EQ(reserved.GetRows(), 2);
+  ASSERT_EQ(reserved.GetCols(), 2);
+  ASSERT_EQ(reserved(1, 1), 5);
+  const double* data = reserved.Data();
+  reserved.SetCols(30);
+  reserved.SetRows(100);
+  ASSERT_EQ(reserved.Data(), data);
+  EXPECT_THROW(reserved.Reserve(-1, 2), std::invalid_argument);
+}
+
 TEST(CONSTRUCTORS, Default) {
   S21Matrix tt;
 
@@ -168,6 +292,30 @@ TEST(CONSTRUCTORS, MoveMatrix) {
   GTEST_ASSERT_TRUE(tt2(0, 0) == 2);
 }
 
+TEST(CONSTRUCTORS, MoveWithoutAllocation) {
+  S21Matrix a(64, 32);
+  a(63, 31) = 7;
+  const double* data = &a(0, 0);
+  S21Matrix c;
+
+  long before = BufferRequests();
+  S21Matrix b(std::move(a));
+  c = std::move(b);
+  ASSERT_EQ(BufferRequests(), before);
+  ASSERT_EQ(&c(0, 0), data);
+  ASSERT_EQ(a.GetRows(), 0);
+  ASSERT_EQ(b.GetRows(), 0);
+  ASSERT_EQ(c.GetRows(), 64);
+  ASSERT_EQ(c(63, 31), 7);
+
+  S21Matrix t = c.Transpose();
+  ASSERT_EQ(BufferRequests() - before, 1);
+  t = std::move(c);
+  ASSERT_EQ(BufferRequests() - before, 1);
+  ASSERT_EQ(&t(0, 0), data);
+  ASSERT_EQ(c.GetCols(), 0);
+}
+
 TEST(CONSTRUCTORS, CopyMatrix) {
   S21Matrix res1(3, 3);
   int counter = 0;
@@ -199,6 +347,236 @@ TEST(TestMatrix, operator_brackets) {
   EXPECT_THROW(A(0, -3), std::out_of_range);
 }
 
+TEST(TestMatrix, unchecked_access) {
+  S21Matrix A(3, 4);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) A.Get(i, j) = i * 10 + j;
+  }
+
+  const S21Matrix& C = A;
+  ASSERT_EQ(C.Data(), &A(0, 0));
+  ASSERT_EQ(C.RowPtr(2), &A(2, 0));
+  ASSERT_EQ(C.Get(1, 3), 13);
+
+  S21RowView<double> row = A.Row(1);
+  ASSERT_EQ(row.size(), 4);
+  for (double& value : row) value = -value;
+  ASSERT_EQ(A(1, 2), -12);
+
+  double sum = 0;
+  for (double value : C.Row(2)) sum += value;
+  ASSERT_EQ(sum, 20 + 21 + 22 + 23);
+  ASSERT_EQ(C.Row(0)[3], 3);
+}
+
+TEST(TestMatrix, views) {
+  S21Matrix a(6, 5);
+  for (int i = 0; i < 6; ++i) {
+    for (int j = 0; j < 5; ++j) a(i, j) = (i * 5 + j) % 7 + (i == j) * 3;
+  }
+  S21Matrix top(3, 3), right(6, 2);
+  for (int i = 0; i < 6; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      if (i < 3 && j < 3) top(i, j) = a(i, j);
+      if (j >= 3) right(i, j - 3) = a(i, j);
+    }
+  }
+
+  long before = BufferRequests();
+  S21MatrixView block = a.Block(0, 0, 3, 3);
+  S21MatrixView cols = a.Block(0, 3, 6, 2);
+  S21MatrixView rows = a.RowRange(2, 3);
+  ASSERT_EQ(block.GetStride(), a.GetStride());
+  ASSERT_EQ(cols.Data(), &a(0, 3));
+  ASSERT_EQ(rows(0, 4), a(2, 4));
+  ASSERT_TRUE(block == top);
+  ASSERT_TRUE(cols.EqMatrix(right));
+  ASSERT_TRUE(rows.Block(1, 3, 2, 2) == a.Block(3, 3, 2, 2));
+  ASSERT_FALSE(block == a.Block(1, 0, 3, 3));
+  ASSERT_EQ(BufferRequests(), before);
+
+  ASSERT_DOUBLE_EQ(block.Determinant(), top.Determinant());
+  ASSERT_TRUE(cols.Transpose() == right.Transpose());
+  ASSERT_TRUE(block * block == top * top);
+  ASSERT_TRUE(rows * a.Block(0, 3, 5, 2) ==
+              S21Matrix(rows) * S21Matrix(a.Block(0, 3, 5, 2)));
+  ASSERT_TRUE(top * a.Block(0, 0, 3, 5) == top * a.RowRange(0, 3));
+  ASSERT_TRUE(block + 2.0 * top - block == 2.0 * top);
+
+  before = BufferRequests();
+  S21Matrix product = cols.Transpose() * cols;
+  // Both the 2x6 transpose and the 2x2 product fit inline.
+  ASSERT_EQ(BufferRequests(), before);
+  ASSERT_TRUE(product == right.Transpose() * right);
+  S21Matrix copy = block;
+  ASSERT_TRUE(copy == top);
+
+  EXPECT_THROW(a.Block(4, 0, 3, 3), std::out_of_range);
+  EXPECT_THROW(a.Block(0, -1, 3, 3), std::out_of_range);
+  EXPECT_THROW(a.RowRange(0, 0), std::invalid_argument);
+  EXPECT_THROW(rows.Determinant(), std::logic_error);
+  EXPECT_THROW(block * cols, std::logic_error);
+}
+
+TEST(TestMatrix, padded_storage) {
+  for (int cols : {1, 7, 8, 9, 128, 256, 1000}) {
+    S21Matrix A(3, cols);
+    ASSERT_EQ(A.GetCols(), cols);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(A.Data()) % 64, 0u);
+    ASSERT_GE(A.GetStride(), cols);
+    if (cols >= 8) {
+      ASSERT_EQ(A.GetStride() % 8, 0);
+      ASSERT_NE(A.GetStride() % 128, 0);
+      ASSERT_EQ(reinterpret_cast<std::uintptr_t>(A.RowPtr(2)) % 64, 0u);
+    }
+  }
+
+  // An in-place transpose leaves an unpadded 16 x 9 matrix, a fresh one is
+  // padded to 16 doubles per row; every operation must agree across both.
+  S21Matrix base(9, 16);
+  for (int i = 0; i < 9; ++i) {
+    for (int j = 0; j < 16; ++j) base(i, j) = i * 16 + j;
+  }
+  S21Matrix flat(base);
+  flat.TransposeInPlace();
+  S21Matrix padded = base.Transpose();
+  ASSERT_EQ(flat.GetStride(), 9);
+  ASSERT_EQ(padded.GetStride(), 16);
+  ASSERT_TRUE(flat == padded);
+
+  S21Matrix sum = flat + padded;
+  sum -= padded;
+  sum *= 2.0;
+  ASSERT_TRUE(sum == 2.0 * flat);
+  ASSERT_TRUE(base * flat == base * padded);
+  ASSERT_TRUE(flat.Transpose() == base);
+
+  S21Matrix assigned(16, 9);
+  assigned = flat;
+  ASSERT_EQ(assigned.GetStride(), 16);
+  ASSERT_TRUE(assigned == padded);
+  padded(15, 8) = -1;
+  ASSERT_FALSE(flat == padded);
+}
+
+TEST(TestMatrix, inline_storage) {
+  S21Matrix a(4, 4), b(4, 4);
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      a(i, j) = (i * 3 + j) % 5 + (i == j) * 4;
+      b(i, j) = i - j;
+    }
+  }
+
+  long before = BufferRequests();
+  S21Matrix product = a * b;
+  S21Matrix inverse = a.InverseMatrix();
+  S21Matrix sum = a + b - a.Transpose();
+  double minor = a.CalcMinor(1, 2, 3);
+  S21Matrix moved(std::move(product));
+  product = std::move(moved);
+  ASSERT_EQ(BufferRequests(), before);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(product.Data()) % 64, 0u);
+  ASSERT_TRUE(product == S21Matrix(a.Block(0, 0, 4, 4)) * b);
+  ASSERT_TRUE(a * inverse == a * inverse * a * inverse);
+  ASSERT_EQ(sum(3, 0), b(3, 0) + a(3, 0) - a(0, 3));
+  ASSERT_DOUBLE_EQ(minor, a.CalcComplements()(1, 2) * -1);
+  ASSERT_EQ(moved.GetRows(), 0);
+
+  // Growing out of the inline buffer and back keeps every element.
+  S21Matrix grow(a);
+  grow.SetCols(5);
+  grow.SetRows(9);
+  ASSERT_NE(BufferRequests(), before);
+  ASSERT_EQ(grow(3, 3), a(3, 3));
+  ASSERT_EQ(grow(8, 4), 0);
+  grow.SetRows(2);
+  grow.ShrinkToFit();
+  ASSERT_EQ(grow(1, 1), a(1, 1));
+  ASSERT_EQ(grow(1, 4), 0);
+  grow.SetCols(6);
+  grow(1, 5) = 7;
+  S21Matrix stolen = std::move(grow);
+  ASSERT_EQ(stolen(1, 5), 7);
+  ASSERT_EQ(stolen(0, 3), a(0, 3));
+
+  S21Matrix rows;
+  rows.Reserve(0, 3);
+  before = BufferRequests();
+  for (int i = 0; i < 5; ++i) rows.AppendRow(a.RowPtr(i % 4));
+  rows.AppendRow(rows.RowPtr(0));
+  ASSERT_EQ(BufferRequests() - before, 1);
+  ASSERT_EQ(rows(5, 2), a(0, 2));
+  ASSERT_EQ(rows(4, 1), a(0, 1));
+}
+
+TEST(TestMatrix, element_types) {
+  S21MatrixT<float> f(3, 3);
+  S21MatrixT<long double> l(3, 3);
+  S21MatrixT<std::complex<double>> c(3, 3);
+  double values[3][3] = {{4, 1, 2}, {3, 5, 1}, {1, 2, 6}};
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      f(i, j) = static_cast<float>(values[i][j]);
+      l(i, j) = values[i][j];
+      c(i, j) = std::complex<double>(values[i][j], i - j);
+    }
+  }
+
+  ASSERT_FLOAT_EQ(f.Determinant(), 97);
+  ASSERT_NEAR(static_cast<double>(l.Determinant()), 97, 1e-15);
+  S21MatrixT<float> f_id = f * f.InverseMatrix();
+  S21MatrixT<long double> l_id = l.InverseMatrix() * l;
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      ASSERT_NEAR(f_id(i, j), i == j, 1e-5);
+      ASSERT_NEAR(static_cast<double>(l_id(i, j)), i == j, 1e-15);
+    }
+  }
+  ASSERT_TRUE(f.Transpose().Transpose() == f);
+  ASSERT_TRUE(2.0f * f - f == f);
+  ASSERT_TRUE((f + f) * f == 2.0f * (f * f));
+
+  // det = sum of (-1)^j c0j M0j, checked against the cofactor expansion.
+  std::complex<double> det = c.Determinant();
+  S21MatrixT<std::complex<double>> cof = c.CalcComplements();
+  std::complex<double> expansion = 0;
+  for (int j = 0; j < 3; ++j) expansion += c(0, j) * cof(0, j);
+  ASSERT_NEAR(std::abs(det - expansion), 0, 1e-12);
+  ASSERT_NE(det.imag(), 0);
+  S21MatrixT<std::complex<double>> c_id = c * c.InverseMatrix();
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      ASSERT_NEAR(std::abs(c_id(i, j) - double(i == j)), 0, 1e-12);
+    }
+  }
+  S21MatrixT<std::complex<double>> scaled = c * std::complex<double>(0, 1);
+  ASSERT_EQ(scaled(1, 0), std::complex<double>(-1, 3));
+  ASSERT_TRUE(c + c == 2.0 * c);
+  ASSERT_TRUE(c.Solve(c_id) == c.InverseMatrix());
+}
+
+TEST(TestMatrix, eq_tolerance) {
+  ASSERT_EQ(S21Matrix::GetEqTolerance(), 1e-6);
+  ASSERT_EQ(S21MatrixT<float>::GetEqTolerance(), 1e-4f);
+
+  S21MatrixT<float> a(2, 20), b(2, 20);
+  a(1, 19) = 1000.0f;
+  b(1, 19) = 1000.0f + 6.1e-5f;
+  ASSERT_TRUE(a == b);
+  ASSERT_TRUE(a.EqMatrix(b + b - b));
+
+  S21Matrix x(2, 20), y(2, 20);
+  y(1, 19) = 1e-3;
+  ASSERT_FALSE(x == y);
+  S21Matrix::SetEqTolerance(1e-2);
+  ASSERT_TRUE(x == y);
+  ASSERT_TRUE(x.EqMatrix(y + x));
+  ASSERT_FALSE(a == 2.0f * b);
+  S21Matrix::SetEqTolerance(1e-6);
+  ASSERT_FALSE(x == y);
+}
+
 TEST(TestSumMatrix, sum_matrix_1) {
   S21Matrix A(2, 2);
   S21Matrix B(2, 2);
@@ -496,6 +874,86 @@ TEST(TestMatrix, operator_sum) {
   ASSERT_EQ((a + c).EqMatrix(res), true);
 }
 
+TEST(TestMatrix, fused_expression) {
+  S21Matrix a(3, 4);
+  S21Matrix b(3, 4);
+  S21Matrix c(3, 4);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      a(i, j) = i + j;
+      b(i, j) = i * j;
+      c(i, j) = i - j;
+    }
+  }
+
+  S21Matrix r = a + b - 2.0 * c;
+  ASSERT_EQ((a + b - c * 2).GetRows(), 3);
+  ASSERT_EQ((a + b - c * 2).GetCols(), 4);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      ASSERT_EQ(r(i, j), i + j + i * j - 2.0 * (i - j));
+      ASSERT_EQ((a - c)(i, j), 2 * j);
+    }
+  }
+  ASSERT_TRUE(r == a + b - 2.0 * c);
+  ASSERT_TRUE((a + b).EqMatrix(b + a));
+  EXPECT_THROW((a - c)(3, 0), std::out_of_range);
+
+  r += a - b;
+  r -= 0.5 * (a + a);
+  ASSERT_EQ(r(2, 3), 5 + 6 + 2 - 6);
+
+  a = a + a;
+  ASSERT_EQ(a(2, 3), 10);
+
+  S21Matrix t(4, 2);
+  t(3, 1) = 1;
+  S21Matrix p = (b + c) * t;
+  ASSERT_EQ(p.GetRows(), 3);
+  ASSERT_EQ(p.GetCols(), 2);
+  ASSERT_EQ(p(2, 1), 2 * 3 + 2 - 3);
+  ASSERT_TRUE(p == b * t + c * t);
+  ASSERT_TRUE(t.Transpose() * (b + c).Transpose() == p.Transpose());
+
+  EXPECT_THROW(a + b - t, std::logic_error);
+  EXPECT_THROW(r += t + t, std::logic_error);
+}
+
+TEST(TestMatrix, rvalue_operands) {
+  // Large enough to live in pooled buffers rather than inline.
+  S21Matrix a(6, 4);
+  S21Matrix b(4, 6);
+  S21Matrix c(6, 6);
+  for (int i = 0; i < 6; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      a(i, j) = i + j;
+      b(j, i) = i - j;
+    }
+    for (int j = 0; j < 6; ++j) c(i, j) = i * j;
+  }
+
+  long before = BufferRequests();
+  S21Matrix r1 = (a * b + c) - c;
+  ASSERT_EQ(BufferRequests() - before, 1);
+  S21Matrix r2 = a - 2.0 * (b.Transpose() + a);
+  ASSERT_EQ(BufferRequests() - before, 2);
+  S21Matrix r3 = 0.5 * (a * b) - (c * c) * 3;
+  ASSERT_EQ(BufferRequests() - before, 4);
+  S21Matrix r4 = (a * b) + (c * c);
+  ASSERT_EQ(BufferRequests() - before, 6);
+
+  S21Matrix ab = a * b;
+  S21Matrix cc = c * c;
+  ASSERT_TRUE(r1 == ab);
+  ASSERT_TRUE(r3 == 0.5 * ab - 3 * cc);
+  ASSERT_TRUE(r4 == ab + cc);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 2; ++j) ASSERT_EQ(r2(i, j), i + j - 2.0 * (2 * i));
+  }
+  EXPECT_THROW(a.Transpose() + c, std::logic_error);
+  EXPECT_THROW(c - a.Transpose(), std::logic_error);
+}
+
 TEST(TestMatrix, operator_app_sum) {
   S21Matrix a = S21Matrix(2, 2);
   S21Matrix b = S21Matrix(2, 3);
@@ -1176,6 +1634,39 @@ TEST(TestMatrix, mul_2) {
   ASSERT_EQ(a.EqMatrix(res), true);
 }
 
+TEST(TestMatrix, mul_blocked) {
+  S21Matrix a(131, 97);
+  S21Matrix b(97, 75);
+  for (int i = 0; i < a.GetRows(); ++i) {
+    for (int j = 0; j < a.GetCols(); ++j) {
+      a(i, j) = (i * 7 + j * 3) % 11 - 5;
+    }
+  }
+  for (int i = 0; i < b.GetRows(); ++i) {
+    for (int j = 0; j < b.GetCols(); ++j) {
+      b(i, j) = (i * 5 + j * 2) % 13 - 6;
+    }
+  }
+
+  S21Matrix res(131, 75);
+  for (int i = 0; i < res.GetRows(); ++i) {
+    for (int j = 0; j < res.GetCols(); ++j) {
+      for (int m = 0; m < a.GetCols(); ++m) {
+        res(i, j) += a(i, m) * b(m, j);
+      }
+    }
+  }
+
+  S21Matrix c = a * b;
+  ASSERT_EQ(c.GetRows(), 131);
+  ASSERT_EQ(c.GetCols(), 75);
+  ASSERT_TRUE(c == res);
+
+  a *= b;
+  ASSERT_TRUE(a == res);
+  EXPECT_THROW(a.MulMatrix(b), std::logic_error);
+}
+
 TEST(TestMulNumber, mul_number_1) {
   S21Matrix A(1, 1);
   S21Matrix R(1, 1);
@@ -1681,6 +2172,19 @@ TEST(TestDeterminant, comp_7) {
   EXPECT_THROW(A.CalcComplements(), std::logic_error);
 }
 
+TEST(TestMatrix, calc_minor_bad_arguments) {
+  S21Matrix a(20, 20), small(3, 3);
+  for (int i = 0; i < 3; ++i) small(i, i) = i + 1;
+
+  ASSERT_EQ(small.CalcMinor(0, 0, 2), 6);
+  EXPECT_THROW(a.CalcMinor(0, 0, 5), std::out_of_range);
+  EXPECT_THROW(a.CalcMinor(0, 0, 20), std::out_of_range);
+  EXPECT_THROW(a.CalcMinor(20, 0, 19), std::out_of_range);
+  EXPECT_THROW(a.CalcMinor(0, -1, 19), std::out_of_range);
+  EXPECT_THROW(small.CalcMinor(0, 3, 2), std::out_of_range);
+  EXPECT_THROW(S21Matrix(3, 4).CalcMinor(0, 0, 2), std::logic_error);
+}
+
 TEST(TestMatrix, complements) {
   S21Matrix a = S21Matrix(3, 4);
 
@@ -1722,6 +2226,43 @@ TEST(TestMatrix, complements) {
   ASSERT_TRUE(R.EqMatrix(res));
 }
 
+S21Matrix ComplementsByMinors(const S21Matrix& a) {
+  S21Matrix res(a.GetRows(), a.GetCols());
+  for (int i = 0; i < a.GetRows(); ++i) {
+    for (int j = 0; j < a.GetCols(); ++j) {
+      res(i, j) = ((i + j) % 2 ? -1 : 1) * a.CalcMinor(i, j, a.GetRows() - 1);
+    }
+  }
+  return res;
+}
+
+TEST(TestMatrix, complements_rank) {
+  S21Matrix a(6, 6);
+  for (int i = 0; i < 6; ++i) {
+    for (int j = 0; j < 6; ++j) a(i, j) = (i * 5 + j * 3) % 7 - 2.5 + (i == j);
+  }
+  ASSERT_TRUE(a.CalcComplements() == ComplementsByMinors(a));
+
+  for (int j = 0; j < 6; ++j) a(5, j) = a(0, j) - 2 * a(3, j);
+  ASSERT_TRUE(a.CalcComplements() == ComplementsByMinors(a));
+
+  for (int j = 0; j < 6; ++j) a(4, j) = 3 * a(1, j);
+  ASSERT_TRUE(a.CalcComplements() == S21Matrix(6, 6));
+  ASSERT_TRUE(S21Matrix(4, 4).CalcComplements() == S21Matrix(4, 4));
+
+  S21Matrix b(2, 2);
+  b(0, 0) = 1;
+  b(0, 1) = 2;
+  b(1, 0) = 2;
+  b(1, 1) = 4;
+  S21Matrix res(2, 2);
+  res(0, 0) = 4;
+  res(0, 1) = -2;
+  res(1, 0) = -2;
+  res(1, 1) = 1;
+  ASSERT_TRUE(b.CalcComplements() == res);
+}
+
 TEST(TestDeterminant, det_1) {
   S21Matrix A(3, 3);
   A(0, 0) = 3.0;
@@ -1880,6 +2421,35 @@ TEST(TestMatrix, transpose_3) {
   ASSERT_EQ(t.EqMatrix(a), true);
 }
 
+TEST(TestMatrix, transpose_large) {
+  for (int rows : {1, 5, 64, 77}) {
+    for (int cols : {1, 3, 64, 90}) {
+      S21Matrix a(rows, cols);
+      for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < cols; ++j) a(i, j) = i * 1000 + j;
+      }
+
+      S21Matrix t = a.Transpose();
+      ASSERT_EQ(t.GetRows(), cols);
+      ASSERT_EQ(t.GetCols(), rows);
+      S21Matrix in_place(a);
+      in_place.TransposeInPlace();
+      ASSERT_EQ(in_place.GetRows(), cols);
+      ASSERT_EQ(in_place.GetCols(), rows);
+      for (int i = 0; i < cols; ++i) {
+        for (int j = 0; j < rows; ++j) {
+          ASSERT_EQ(t(i, j), j * 1000 + i);
+          ASSERT_EQ(in_place(i, j), j * 1000 + i);
+        }
+      }
+    }
+  }
+
+  S21Matrix empty;
+  empty.TransposeInPlace();
+  ASSERT_EQ(empty.GetRows(), 0);
+}
+
 TEST(TestDeterminant, inverse_1) {
   S21Matrix A(3, 3);
   A(0, 0) = 1.0;
@@ -2078,6 +2648,626 @@ TEST(TestMatrix, inverse) {
   EXPECT_THROW(b.InverseMatrix(), std::logic_error);
 }
 
+TEST(TestMatrix, inverse_large) {
+  const int n = 60;
+  S21Matrix a(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) a(i, j) = (i * 13 + j * 7) % 17 - 8;
+    a(i, i) += 3 * n;
+  }
+
+  S21Matrix identity(n, n);
+  for (int i = 0; i < n; ++i) identity(i, i) = 1;
+
+  ASSERT_TRUE(a * a.InverseMatrix() == identity);
+  ASSERT_TRUE(a.InverseMatrix() * a == identity);
+
+  for (int j = 0; j < n; ++j) a(n - 1, j) = 0;
+  EXPECT_THROW(a.InverseMatrix(), std::logic_error);
+
+  S21Matrix v(1, 1);
+  v(0, 0) = 4;
+  ASSERT_EQ(v.InverseMatrix()(0, 0), 0.25);
+  EXPECT_THROW(S21Matrix().InverseMatrix(), std::logic_error);
+}
+
+TEST(TestLU, reuse) {
+  S21Matrix a(3, 3);
+  a(0, 0) = 2;
+  a(0, 1) = 1;
+  a(0, 2) = 1;
+  a(1, 0) = 4;
+  a(1, 1) = -6;
+  a(1, 2) = 0;
+  a(2, 0) = -2;
+  a(2, 1) = 7;
+  a(2, 2) = 2;
+
+  S21LU lu(a);
+  ASSERT_EQ(lu.GetSize(), 3);
+  ASSERT_FALSE(lu.IsSingular());
+  ASSERT_NEAR(lu.Determinant(), -16, 1e-12);
+
+  std::vector<double> x = lu.Solve(std::vector<double>{5, -2, 9});
+  ASSERT_NEAR(x[0], 1, 1e-12);
+  ASSERT_NEAR(x[1], 1, 1e-12);
+  ASSERT_NEAR(x[2], 2, 1e-12);
+
+  S21Matrix b(3, 2);
+  b(0, 0) = 5;
+  b(1, 0) = -2;
+  b(2, 0) = 9;
+  b(0, 1) = 4;
+  b(1, 1) = 4;
+  b(2, 1) = 5;
+  S21Matrix xs = lu.Solve(b);
+  ASSERT_TRUE(a * xs == b);
+  ASSERT_TRUE(lu.Inverse() == a.InverseMatrix());
+
+  EXPECT_THROW(lu.Solve(std::vector<double>{1, 2}), std::logic_error);
+  EXPECT_THROW(lu.Solve(S21Matrix(2, 3)), std::logic_error);
+  EXPECT_THROW(S21LU(S21Matrix(2, 3)), std::logic_error);
+}
+
+TEST(TestLU, singular) {
+  S21Matrix a(3, 3);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) a(i, j) = i + j;
+  }
+
+  S21LU lu(a);
+  ASSERT_TRUE(lu.IsSingular());
+  EXPECT_THROW(lu.Inverse(), std::logic_error);
+  EXPECT_THROW(lu.Solve(std::vector<double>{1, 2, 3}), std::logic_error);
+}
+
+TEST(TestLU, log_determinant) {
+  const int n = 400;
+  S21Matrix big(n, n);
+  for (int i = 0; i < n; ++i) big(i, i) = 10;
+  big(0, 0) = 0;
+  big(0, 1) = 10;
+  big(1, 1) = 0;
+  big(1, 0) = 10;
+  ASSERT_TRUE(std::isinf(big.Determinant()));
+  S21LogDeterminant<double> log_det = big.LogAbsDeterminant();
+  ASSERT_EQ(log_det.sign, -1);
+  ASSERT_NEAR(log_det.log_abs, n * std::log(10.0), 1e-9);
+
+  // The pivot product underflows to zero, yet det = 1.
+  S21Matrix scaled(4, 4);
+  scaled(0, 0) = scaled(1, 1) = 1e-200;
+  scaled(2, 2) = scaled(3, 3) = 1e200;
+  S21LU lu(scaled);
+  ASSERT_EQ(lu.Determinant(), 0);
+  ASSERT_FALSE(lu.IsSingular());
+  ASSERT_EQ(lu.LogAbsDeterminant().sign, 1);
+  ASSERT_NEAR(lu.LogAbsDeterminant().log_abs, 0, 1e-12);
+  ASSERT_NEAR(lu.Inverse()(3, 3), 1e-200, 1e-212);
+
+  S21Matrix singular(3, 3);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) singular(i, j) = i + j;
+  }
+  log_det = S21MatrixView(singular).LogAbsDeterminant();
+  ASSERT_EQ(log_det.sign, 0);
+  ASSERT_TRUE(std::isinf(log_det.log_abs) && log_det.log_abs < 0);
+
+  using Complex = std::complex<double>;
+  S21MatrixT<Complex> rotation(2, 2);
+  rotation(0, 0) = Complex(0, 2);
+  rotation(1, 1) = Complex(0, 3);
+  S21LogDeterminant<Complex> phase = rotation.LogAbsDeterminant();
+  ASSERT_NEAR(std::abs(phase.sign - Complex(-1)), 0, 1e-15);
+  ASSERT_NEAR(phase.log_abs, std::log(6.0), 1e-15);
+}
+
+TEST(TestCholesky, factorization) {
+  // B^T * B + n * I is positive definite; 300 rows span several panels
+  // and the parallel trailing update.
+  const int n = 300;
+  S21Matrix b(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) b(i, j) = (i * 7 + j * 3) % 11 - 5;
+  }
+  S21Matrix a = b.Transpose() * b, identity(n, n);
+  for (int i = 0; i < n; ++i) {
+    a(i, i) += n;
+    identity(i, i) = 1;
+  }
+
+  S21ThreadPool& pool = S21ThreadPool::Instance();
+  pool.SetThreadCount(1);
+  S21Cholesky serial(a);
+  pool.SetThreadCount(3);
+  S21Cholesky chol(a);
+  ASSERT_TRUE(chol.IsPositiveDefinite());
+  ASSERT_EQ(chol.GetSize(), n);
+  ASSERT_TRUE(chol.Inverse() == serial.Inverse());
+  ASSERT_TRUE(a * chol.Inverse() == identity);
+  pool.SetThreadCount(0);
+
+  S21Matrix l(a);
+  ASSERT_EQ(S21CholeskyDecompose(l.Data(), n, l.GetStride()), n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = i + 1; j < n; ++j) l(i, j) = 0;
+  }
+  ASSERT_TRUE(l * l.Transpose() == a);
+
+  S21LogDeterminant<double> lu = S21LU(a).LogAbsDeterminant();
+  S21LogDeterminant<double> spd = chol.LogAbsDeterminant();
+  ASSERT_EQ(spd.sign, 1);
+  ASSERT_NEAR(spd.log_abs, lu.log_abs, 1e-9 * lu.log_abs);
+  ASSERT_EQ(a.LogAbsDeterminant().log_abs, lu.log_abs);
+
+  std::vector<double> rhs(n, 1.0);
+  std::vector<double> x = chol.Solve(rhs);
+  for (int i = 0; i < n; i += 37) {
+    double sum = 0;
+    for (int j = 0; j < n; ++j) sum += a(i, j) * x[j];
+    ASSERT_NEAR(sum, 1, 1e-9);
+  }
+  S21Matrix rhs_m = b.Block(0, 0, n, 2);
+  ASSERT_TRUE(a * a.Solve(rhs_m) == rhs_m);
+  ASSERT_TRUE(a.InverseMatrix() == S21LU(a).Inverse());
+
+  using Complex = std::complex<double>;
+  // Two panels, so the conjugated trailing update runs too.
+  const int m = 70;
+  S21MatrixT<Complex> z(m, m), h(m, m);
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < m; ++j) z(i, j) = Complex((i + j) % 5, (i * j) % 3);
+  }
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < m; ++j) {
+      Complex sum = i == j ? m : 0;
+      for (int k = 0; k < m; ++k) sum += std::conj(z(k, i)) * z(k, j);
+      h(i, j) = sum;
+    }
+  }
+  S21CholeskyT<Complex> hermitian(h);
+  ASSERT_TRUE(hermitian.IsPositiveDefinite());
+  S21LogDeterminant<Complex> log_det = S21LUT<Complex>(h).LogAbsDeterminant();
+  ASSERT_NEAR(hermitian.LogAbsDeterminant().log_abs, log_det.log_abs, 1e-9);
+  S21MatrixT<Complex> product = h * hermitian.Inverse();
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < m; ++j) {
+      ASSERT_NEAR(std::abs(product(i, j) - Complex(i == j)), 0, 1e-12);
+    }
+  }
+}
+
+TEST(TestCholesky, not_positive_definite) {
+  S21Matrix a(4, 4);
+  for (int i = 0; i < 4; ++i) a(i, i) = 1;
+  a(2, 2) = -1;
+  S21Matrix indefinite(a);
+  indefinite(2, 2) = 1;
+  indefinite(2, 3) = indefinite(3, 2) = 2;
+  S21Matrix asymmetric(a), tiny(2, 2);
+  asymmetric(2, 2) = 1;
+  asymmetric(0, 3) = 1;
+  tiny(0, 0) = tiny(1, 1) = 1e-4;
+
+  ASSERT_FALSE(S21Cholesky(a).IsPositiveDefinite());
+  ASSERT_FALSE(S21Cholesky(indefinite).IsPositiveDefinite());
+  ASSERT_FALSE(S21Cholesky(asymmetric).IsPositiveDefinite());
+  ASSERT_EQ(S21CholeskyDecompose(indefinite.Data(), 4, indefinite.GetStride()),
+            3);
+  EXPECT_THROW(S21Cholesky(a).Determinant(), std::logic_error);
+  EXPECT_THROW(S21Cholesky(indefinite).Inverse(), std::logic_error);
+  EXPECT_THROW(S21Cholesky(S21Matrix(2, 3)), std::logic_error);
+  ASSERT_TRUE(S21Cholesky(tiny).IsPositiveDefinite());
+  EXPECT_THROW(S21Cholesky(tiny).Inverse(), std::logic_error);
+
+  // Symmetric only to within 1e-6: only an explicit tolerance factors the
+  // mirrored lower triangle, and S21Matrix stays on LU.
+  S21Matrix near(2, 2);
+  near(0, 0) = near(1, 1) = 1;
+  near(0, 1) = 0.999;
+  near(1, 0) = 0.9990009;
+  ASSERT_FALSE(S21Cholesky(near).IsPositiveDefinite());
+  ASSERT_TRUE(S21Cholesky(near, 1e-6).IsPositiveDefinite());
+  S21LU near_lu(near);
+  S21Matrix near_inv = near.InverseMatrix();
+  for (int i = 0; i < 2; ++i) {
+    for (int j = 0; j < 2; ++j) {
+      ASSERT_EQ(near_inv(i, j), near_lu.Inverse()(i, j));
+    }
+  }
+  S21Matrix near_identity = near * near_inv;
+  ASSERT_NEAR(near_identity(0, 0), 1, 1e-12);
+  ASSERT_NEAR(near_identity(1, 0), 0, 1e-12);
+  ASSERT_EQ(near.Determinant(), near_lu.Determinant());
+  ASSERT_EQ(near.LogAbsDeterminant().log_abs,
+            near_lu.LogAbsDeterminant().log_abs);
+  S21MatrixT<std::complex<double>> complex_diag(1, 1);
+  complex_diag(0, 0) = std::complex<double>(1, 1e-9);
+  ASSERT_FALSE(
+      S21CholeskyT<std::complex<double>>(complex_diag).IsPositiveDefinite());
+
+  // General matrices keep going through LU.
+  ASSERT_EQ(indefinite.Determinant(), -3);
+  ASSERT_EQ(asymmetric.InverseMatrix()(0, 3), -1);
+}
+
+TEST(TestFixedMatrix, constexpr_ops) {
+  constexpr S21FixedMatrix<2, 3> a{1, 2, 3, 4, 5, 6};
+  constexpr S21FixedMatrix<3, 2> b = a.Transpose();
+  constexpr S21FixedMatrix<2, 2> ab = a * b;
+  static_assert(ab.Get(0, 0) == 14 && ab.Get(0, 1) == 32, "");
+  static_assert(ab.Get(1, 0) == 32 && ab.Get(1, 1) == 77, "");
+  static_assert(ab.Determinant() == 14 * 77 - 32 * 32, "");
+  static_assert((2.0 * ab - ab - ab).Get(1, 1) == 0, "");
+  static_assert(ab.InverseMatrix().Get(0, 1) == -32.0 / 54, "");
+  static_assert(S21FixedMatrix<6, 6>::Identity().Determinant() == 1, "");
+  static_assert(S21FixedMatrix<3, 3>::GetRows() == 3, "");
+
+  using M23 = S21FixedMatrix<2, 3>;
+  using M32 = S21FixedMatrix<3, 2>;
+  static_assert(CanMultiply<M23, M32>::value, "");
+  static_assert(!CanMultiply<M23, M23>::value, "");
+  static_assert(!CanAdd<M23, M32>::value, "");
+  static_assert(CanAdd<M23, M23>::value, "");
+}
+
+TEST(TestFixedMatrix, matches_dynamic) {
+  S21FixedMatrix<2, 2> m2{3, -1, 4, 2};
+  S21FixedMatrix<3, 3> m3{2, 0, 1, 1, 3, 2, 1, 1, 4};
+  S21FixedMatrix<4, 4> m4{4, 1, 2, 0, 3, 5, 1, 1, 1, 2, 6, 2, 0, 1, 1, 7};
+  S21FixedMatrix<6, 6> m6;
+  for (int i = 0; i < 6; ++i) {
+    for (int j = 0; j < 6; ++j) {
+      m6(i, j) = (i * 7 + j * 3) % 11 - 5 + 9 * (i == j);
+    }
+  }
+
+  ASSERT_DOUBLE_EQ(m2.Determinant(), S21Matrix(m2).Determinant());
+  ASSERT_DOUBLE_EQ(m3.Determinant(), S21Matrix(m3).Determinant());
+  ASSERT_NEAR(m4.Determinant(), S21Matrix(m4).Determinant(), 1e-9);
+  ASSERT_NEAR(m6.Determinant(), S21Matrix(m6).Determinant(), 1e-6);
+  ASSERT_TRUE(S21Matrix(m2.InverseMatrix()) == S21Matrix(m2).InverseMatrix());
+  ASSERT_TRUE(S21Matrix(m3.InverseMatrix()) == S21Matrix(m3).InverseMatrix());
+  ASSERT_TRUE(S21Matrix(m4.InverseMatrix()) == S21Matrix(m4).InverseMatrix());
+  ASSERT_TRUE(S21Matrix(m6.InverseMatrix()) == S21Matrix(m6).InverseMatrix());
+  ASSERT_TRUE(m4 * m4.InverseMatrix() == (S21FixedMatrix<4, 4>::Identity()));
+  ASSERT_TRUE(S21Matrix(m4 * m4) == S21Matrix(m4) * S21Matrix(m4));
+  ASSERT_TRUE(S21Matrix(m6.Transpose()) == S21Matrix(m6).Transpose());
+
+  S21Matrix dynamic(m4);
+  S21FixedMatrix<4, 4> back(dynamic);
+  ASSERT_TRUE(back == m4);
+  S21FixedMatrix<2, 2> corner(dynamic.Block(2, 2, 2, 2));
+  ASSERT_EQ(corner(1, 1), 7);
+  ASSERT_TRUE(m4.View() * dynamic == dynamic * dynamic);
+
+  S21FixedMatrix<3, 3> acc = m3;
+  acc += m3;
+  acc -= m3 * 3.0;
+  acc *= m3;
+  ASSERT_TRUE(acc == -1.0 * (m3 * m3));
+
+  S21FixedMatrix<3, 3> singular{1, 2, 3, 2, 4, 6, 1, 1, 1};
+  EXPECT_THROW(singular.InverseMatrix(), std::logic_error);
+  EXPECT_THROW((S21FixedMatrix<6, 6>().InverseMatrix()), std::logic_error);
+  EXPECT_THROW(m2(2, 0), std::out_of_range);
+  EXPECT_THROW((S21FixedMatrix<3, 3>(dynamic)), std::logic_error);
+}
+
+TEST(TestSparseMatrix, formats) {
+  using Format = S21SparseMatrix::Format;
+  S21Matrix dense(4, 5);
+  dense(0, 1) = 2;
+  dense(1, 4) = -3;
+  dense(2, 0) = 1e-9;
+  dense(3, 1) = 5;
+  dense(3, 3) = 7;
+
+  S21SparseMatrix csr(dense);
+  ASSERT_EQ(csr.NonZeros(), 5);
+  ASSERT_EQ(csr.Offsets(), (std::vector<int>{0, 1, 2, 3, 5}));
+  ASSERT_EQ(csr.Indices(), (std::vector<int>{1, 4, 0, 1, 3}));
+  ASSERT_EQ(S21SparseMatrix(dense, Format::kCsr, 1e-6).NonZeros(), 4);
+  ASSERT_TRUE(csr.ToDense() == dense);
+  ASSERT_EQ(csr(3, 3), 7);
+  ASSERT_EQ(csr(3, 2), 0);
+
+  S21SparseMatrix csc = csr.ToFormat(Format::kCsc);
+  ASSERT_EQ(csc.GetFormat(), Format::kCsc);
+  ASSERT_EQ(csc.Offsets(), (std::vector<int>{0, 1, 3, 3, 4, 5}));
+  ASSERT_EQ(csc.Indices(), (std::vector<int>{2, 0, 3, 3, 1}));
+  ASSERT_EQ(csc(1, 4), -3);
+  ASSERT_TRUE(csc == csr);
+  ASSERT_TRUE(S21Matrix(csc) == dense);
+  ASSERT_TRUE(csr.Transpose().ToDense() == dense.Transpose());
+  ASSERT_TRUE(csc.Transpose().ToDense() == dense.Transpose());
+  ASSERT_EQ(csc.Transpose().GetFormat(), Format::kCsc);
+
+  auto built = S21SparseMatrix::FromTriplets(
+      4, 5, {{3, 3, 4}, {0, 1, 2}, {3, 1, 5}, {1, 4, -3}, {3, 3, 3}},
+      Format::kCsc);
+  ASSERT_EQ(built.NonZeros(), 4);
+  ASSERT_TRUE(built == S21SparseMatrix(dense, Format::kCsr, 1e-6));
+  ASSERT_TRUE(built == csr);
+  ASSERT_FALSE(built == 2.0 * csr);
+
+  S21SparseMatrix diff = csr - csr;
+  ASSERT_EQ(diff.NonZeros(), 5);
+  diff.Prune();
+  ASSERT_EQ(diff.NonZeros(), 0);
+  ASSERT_TRUE(diff == S21SparseMatrix(4, 5));
+
+  EXPECT_THROW(csr(4, 0), std::out_of_range);
+  EXPECT_THROW(S21SparseMatrix::FromTriplets(2, 2, {{2, 0, 1.0}}),
+               std::out_of_range);
+  EXPECT_THROW(S21SparseMatrix(0, 3), std::invalid_argument);
+}
+
+TEST(TestSparseMatrix, products) {
+  using Format = S21SparseMatrix::Format;
+  const int n = 40;
+  S21Matrix a(n, n + 3), b(n + 3, n - 5), v(n + 3, 1);
+  for (int i = 0; i < n + 3; ++i) {
+    for (int j = 0; j < n + 3; ++j) {
+      if (i < n && (i * 7 + j * 3) % 11 == 0) a(i, j) = i - j + 0.5;
+      if (j < n - 5 && (i + j * 5) % 13 == 0) b(i, j) = 1.0 + i * j % 4;
+    }
+    v(i, 0) = i % 3 - 1;
+  }
+
+  for (Format fa : {Format::kCsr, Format::kCsc}) {
+    S21SparseMatrix sa(a, fa);
+    std::vector<double> x(n + 3);
+    for (int i = 0; i < n + 3; ++i) x[i] = v(i, 0);
+    std::vector<double> y = sa.Multiply(x);
+    S21Matrix expected = a * v;
+    for (int i = 0; i < n; ++i) ASSERT_DOUBLE_EQ(y[i], expected(i, 0));
+
+    ASSERT_TRUE(sa * b == a * b);
+    ASSERT_TRUE(b.Transpose() * sa.Transpose() ==
+                b.Transpose() * a.Transpose());
+    for (Format fb : {Format::kCsr, Format::kCsc}) {
+      S21SparseMatrix sb(b, fb);
+      S21SparseMatrix product = sa * sb;
+      ASSERT_EQ(product.GetFormat(), fa);
+      ASSERT_TRUE(product.ToDense() == a * b);
+      S21Matrix reference = a * b;
+      ASSERT_EQ(product(3, 4), reference(3, 4));
+    }
+  }
+
+  S21SparseMatrix sa(a);
+  sa *= S21SparseMatrix(b);
+  ASSERT_TRUE(sa.ToDense() == a * b);
+  EXPECT_THROW(sa * S21SparseMatrix(a), std::logic_error);
+  EXPECT_THROW(S21SparseMatrix(a) * a, std::logic_error);
+  EXPECT_THROW(sa.Multiply(std::vector<double>(3)), std::logic_error);
+}
+
+TEST(TestSparseMatrix, mixed_operators) {
+  S21Matrix dense(3, 3), other(3, 3);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) other(i, j) = i * 3 + j;
+  }
+  dense(0, 2) = 4;
+  dense(2, 1) = -2;
+  S21SparseMatrix sparse(dense);
+
+  ASSERT_TRUE(sparse + other == dense + other);
+  ASSERT_TRUE(other + sparse == dense + other);
+  ASSERT_TRUE(sparse - other == dense - other);
+  ASSERT_TRUE(other - sparse == other - dense);
+  ASSERT_TRUE(sparse + (other + other) == dense + 2.0 * other);
+  ASSERT_TRUE(other * sparse == other * dense);
+  ASSERT_TRUE((2.0 * other) * sparse == 2.0 * (other * dense));
+  ASSERT_TRUE((2.0 * sparse).ToDense() == 2.0 * dense);
+  ASSERT_TRUE((sparse * 0.5 + sparse).ToDense() == 1.5 * dense);
+  ASSERT_TRUE((sparse * sparse).ToDense() == dense * dense);
+
+  S21Matrix acc(other);
+  acc += sparse;
+  acc -= sparse * 3.0;
+  ASSERT_TRUE(acc == other - 2.0 * dense);
+
+  S21SparseMatrixT<std::complex<double>> complex_sparse(
+      S21MatrixT<std::complex<double>>(2, 2));
+  ASSERT_EQ(complex_sparse.NonZeros(), 0);
+  S21SparseMatrixT<float> float_sparse = S21SparseMatrixT<float>::FromTriplets(
+      2, 2, {{0, 0, 1.5f}, {1, 1, 2.0f}});
+  ASSERT_FLOAT_EQ((float_sparse * float_sparse)(1, 1), 4.0f);
+
+  EXPECT_THROW(sparse + S21Matrix(2, 3), std::logic_error);
+  EXPECT_THROW(acc += S21SparseMatrix(2, 3), std::logic_error);
+}
+
+TEST(TestMatrix, strassen) {
+  // Odd and unequal sizes take the peeling paths at every level.
+  const int shapes[][3] = {
+      {64, 64, 64}, {37, 50, 29}, {33, 17, 65}, {40, 9, 40}};
+  for (const auto& shape : shapes) {
+    int m = shape[0], n = shape[1], k = shape[2];
+    S21Matrix a(m, k), b(k, n), expected(m, n), c(m, n);
+    for (int i = 0; i < m; ++i) {
+      for (int j = 0; j < k; ++j) a(i, j) = (i * 5 + j * 3) % 7 - 3;
+    }
+    for (int i = 0; i < k; ++i) {
+      for (int j = 0; j < n; ++j) b(i, j) = (i * 2 + j * 7) % 5 - 2.5;
+    }
+    S21Gemm(m, n, k, a.Data(), a.GetStride(), b.Data(), b.GetStride(),
+            expected.Data(), expected.GetStride());
+    c(0, 0) = 1e9;
+    std::vector<double> work(S21StrassenWorkspace<double>(m, n, k, 8));
+    S21Strassen(m, n, k, a.Data(), a.GetStride(), b.Data(), b.GetStride(),
+                c.Data(), c.GetStride(), work.data(), 8);
+    ASSERT_TRUE(c == expected);
+  }
+
+  S21MatrixT<std::complex<double>> z(20, 20);
+  for (int i = 0; i < 20; ++i) {
+    for (int j = 0; j < 20; ++j) z(i, j) = {double(i - j), double(i * j % 3)};
+  }
+  S21MatrixT<std::complex<double>> expected = z * z;
+  int cutoff = S21GetStrassenCutoff();
+  ASSERT_EQ(cutoff, 1024);
+  S21SetStrassenCutoff(6);
+  ASSERT_TRUE(z * z == expected);
+  S21Matrix a(30, 30);
+  for (int i = 0; i < 30; ++i) a(i, (i * 7) % 30) = 1;
+  S21Matrix squared = a * a;
+  S21SetStrassenCutoff(0);
+  ASSERT_TRUE(squared == a * a);
+  ASSERT_EQ(S21StrassenWorkspace<double>(4096, 4096, 4096, 0), 0);
+  S21SetStrassenCutoff(cutoff);
+}
+
+TEST(TestMatrix, gemm_accumulate) {
+  // Large enough for the packed kernel, with sides that are not multiples
+  // of its register tile.
+  const int m = 70, n = 45, k = 53;
+  S21Matrix a(m, k), b(k, n), c(m, n);
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < k; ++j) a(i, j) = (i * 3 + j * 5) % 9 - 4;
+    for (int j = 0; j < n; ++j) c(i, j) = i - j;
+  }
+  for (int i = 0; i < k; ++i) {
+    for (int j = 0; j < n; ++j) b(i, j) = (i + j * 2) % 7 - 3;
+  }
+  S21Matrix at = a.Transpose(), bt = b.Transpose();
+  S21Matrix expected = 2.0 * (a * b) - 0.5 * c;
+
+  for (int ta = 0; ta < 2; ++ta) {
+    for (int tb = 0; tb < 2; ++tb) {
+      S21Matrix res(c);
+      const double* data = res.Data();
+      long before = BufferRequests();
+      S21Gemm(2.0, ta ? at : a, ta, tb ? bt : b, tb, -0.5, res);
+      ASSERT_EQ(BufferRequests(), before);
+      ASSERT_EQ(res.Data(), data);
+      ASSERT_TRUE(res == expected);
+    }
+  }
+
+  S21Matrix garbage(m, n);
+  for (int i = 0; i < m; ++i) garbage(i, 0) = std::nan("");
+  S21Gemm(1.0, a, false, bt, true, 0.0, garbage);
+  ASSERT_TRUE(garbage == a * b);
+  S21Matrix empty;
+  S21Gemm(1.0, a.Block(0, 0, 4, 4), true, b.Block(1, 2, 4, 3), false, 1.0,
+          empty);
+  ASSERT_TRUE(empty == a.Block(0, 0, 4, 4).Transpose() * b.Block(1, 2, 4, 3));
+
+  // The destination may also be an operand.
+  S21Matrix square(a.Block(0, 0, 20, 20));
+  S21Matrix squared = square * square;
+  S21Gemm(1.0, square, false, square, false, 0.0, square);
+  ASSERT_TRUE(square == squared);
+
+  EXPECT_THROW(S21Gemm(1.0, a, false, b, true, 0.0, c), std::logic_error);
+  EXPECT_THROW(S21Gemm(1.0, a, false, b, false, 1.0, squared),
+               std::logic_error);
+}
+
+TEST(TestMatrix, exact_determinant) {
+  // Pascal matrices have determinant 1 but entries up to C(28, 14).
+  const int n = 15;
+  S21Matrix pascal(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      pascal(i, j) = i == 0 || j == 0 ? 1 : pascal(i - 1, j) + pascal(i, j - 1);
+    }
+  }
+  ASSERT_TRUE(pascal.ExactDeterminant() == 1);
+  ASSERT_NE(pascal.Determinant(), 0);
+  ASSERT_EQ(S21LU(pascal).IsSingular(), false);
+
+  S21Matrix singular(pascal);
+  for (int j = 0; j < n; ++j) singular(n - 1, j) = pascal(2, j) - pascal(5, j);
+  ASSERT_TRUE(singular.ExactDeterminant() == 0);
+
+  S21Matrix swap(2, 2);
+  swap(0, 1) = 1;
+  swap(1, 0) = 1;
+  ASSERT_EQ(swap.Determinant(), -1);
+
+  // 3 * 2^80 needs the 128-bit restart; 2^186 overflows it as well, so
+  // ExactDeterminant() throws while LU still answers.
+  double big = std::ldexp(1.0, 40);
+  S21Matrix wide(3, 3);
+  wide(0, 1) = big;
+  wide(1, 0) = big;
+  wide(2, 2) = 3;
+  wide(2, 0) = 7;
+  ASSERT_TRUE(wide.ExactDeterminant() == -(__int128(3) << 80));
+  ASSERT_EQ(wide.Determinant(), -3 * std::ldexp(1.0, 80));
+  S21Matrix huge(3, 3);
+  for (int i = 0; i < 3; ++i) huge(i, i) = std::ldexp(1.0, 62);
+  EXPECT_THROW(huge.ExactDeterminant(), std::overflow_error);
+  ASSERT_EQ(huge.Determinant(), std::ldexp(1.0, 186));
+
+  const long long ints[] = {2, -1, 0, -1, 2, -1, 0, -1, 2};
+  ASSERT_TRUE(S21BareissDeterminant(ints, 3, 3) == 4);
+  // After the pivots -1 and -2^32 the next step divides -2^63 by -1.
+  S21Matrix trap(4, 4);
+  trap(0, 0) = -1;
+  trap(1, 1) = -std::ldexp(1.0, 32);
+  trap(2, 2) = std::ldexp(1.0, 31);
+  ASSERT_TRUE(trap.ExactDeterminant() == 0);
+  ASSERT_EQ(trap.Determinant(), 0);
+  trap(3, 3) = 3;
+  ASSERT_TRUE(trap.ExactDeterminant() == __int128(3) << 63);
+  S21Matrix half(pascal);
+  half(3, 3) += 0.5;
+  ASSERT_FALSE(S21IsIntegral(half.Data(), n, n, half.GetStride()));
+  EXPECT_THROW(half.ExactDeterminant(), std::invalid_argument);
+  EXPECT_THROW(S21MatrixT<std::complex<double>>(2, 2).ExactDeterminant(),
+               std::invalid_argument);
+  EXPECT_THROW(S21Matrix(2, 3).ExactDeterminant(), std::logic_error);
+
+  S21Matrix empty;
+  ASSERT_EQ(empty.Determinant(), 1);
+  ASSERT_TRUE(empty.ExactDeterminant() == 1);
+  ASSERT_TRUE(S21BareissDeterminant(ints, 0, 3) == 1);
+}
+
+TEST(TestMatrix, solve) {
+  S21Matrix a(3, 3);
+  a(0, 0) = 0;
+  a(0, 1) = 2;
+  a(0, 2) = 1;
+  a(1, 0) = 3;
+  a(1, 1) = 1;
+  a(1, 2) = -1;
+  a(2, 0) = 1;
+  a(2, 1) = 1;
+  a(2, 2) = 1;
+
+  S21Matrix b(3, 1);
+  b(0, 0) = 7;
+  b(1, 0) = 2;
+  b(2, 0) = 6;
+  S21Matrix x = a.Solve(b);
+  ASSERT_EQ(x.GetRows(), 3);
+  ASSERT_EQ(x.GetCols(), 1);
+  ASSERT_NEAR(x(0, 0), 1, 1e-12);
+  ASSERT_NEAR(x(1, 0), 2, 1e-12);
+  ASSERT_NEAR(x(2, 0), 3, 1e-12);
+
+  S21Matrix bs(3, 4);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 4; ++j) bs(i, j) = i * 4 + j;
+  }
+  ASSERT_TRUE(a * a.Solve(bs) == bs);
+  ASSERT_TRUE(a.Solve(bs) == a.InverseMatrix() * bs);
+
+  EXPECT_THROW(a.Solve(S21Matrix(2, 1)), std::logic_error);
+  EXPECT_THROW(S21Matrix(3, 2).Solve(b), std::logic_error);
+  a(2, 0) = 3;
+  a(2, 1) = 3;
+  a(2, 2) = 0;
+  EXPECT_THROW(a.Solve(b), std::logic_error);
+  EXPECT_THROW(a.InverseMatrix(), std::logic_error);
+}
+
 TEST(OVERRIDE, Equal) {
   S21Matrix res1(3, 3);
   S21Matrix res2(3, 3);
@@ -2406,6 +3596,269 @@ TEST(FUNCTIONS, CalcComplements) {
   GTEST_ASSERT_TRUE(result == expected);
 }
 
+TEST(TestSimd, levels) {
+  const long n = 37;
+  double a[n], b[n];
+  for (long i = 0; i < n; ++i) {
+    a[i] = i * 0.5 - 3;
+    b[i] = 7 - i * 0.25;
+  }
+
+  int best = static_cast<int>(S21SimdDetect());
+  for (int level = 0; level <= best; ++level) {
+    const S21SimdKernels& k =
+        S21SimdKernelsFor(static_cast<S21SimdLevel>(level));
+    double c[n];
+    std::copy(a, a + n, c);
+
+    k.add(c, b, n);
+    for (long i = 0; i < n; ++i) ASSERT_DOUBLE_EQ(c[i], a[i] + b[i]);
+    k.sub(c, b, n);
+    k.scale(c, -2, n);
+    for (long i = 0; i < n; ++i) ASSERT_DOUBLE_EQ(c[i], -2 * a[i]);
+
+    ASSERT_TRUE(k.equal(c, c, n, 1e-6));
+    ASSERT_FALSE(k.equal(a, b, n, 1e-6));
+    std::copy(a, a + n, c);
+    c[n - 1] += 1e-3;
+    ASSERT_FALSE(k.equal(a, c, n, 1e-6));
+    ASSERT_TRUE(k.equal(a, c, n - 1, 1e-6));
+
+    double t[n];
+    k.transpose(a, 7, 5, 5, t, 7);
+    for (int i = 0; i < 7; ++i) {
+      for (int j = 0; j < 5; ++j) ASSERT_EQ(t[j * 7 + i], a[i * 5 + j]);
+    }
+  }
+}
+
+TEST(TestSimd, float_levels) {
+  const long n = 43;
+  float a[n], b[n];
+  for (long i = 0; i < n; ++i) {
+    a[i] = i * 0.5f - 3;
+    b[i] = 7 - i * 0.25f;
+  }
+
+  int best = static_cast<int>(S21SimdDetect());
+  for (int level = 0; level <= best; ++level) {
+    const S21SimdKernelsT<float>& k =
+        S21SimdKernelsFor<float>(static_cast<S21SimdLevel>(level));
+    float c[n];
+    std::copy(a, a + n, c);
+
+    k.add(c, b, n);
+    for (long i = 0; i < n; ++i) ASSERT_FLOAT_EQ(c[i], a[i] + b[i]);
+    k.sub(c, b, n);
+    k.scale(c, -2, n);
+    for (long i = 0; i < n; ++i) ASSERT_FLOAT_EQ(c[i], -2 * a[i]);
+
+    std::copy(a, a + n, c);
+    c[n - 1] += 1e-2f;
+    ASSERT_FALSE(k.equal(a, c, n, 1e-4f));
+    ASSERT_TRUE(k.equal(a, c, n - 1, 1e-4f));
+
+    float t[n];
+    k.transpose(a, 9, 4, 4, t, 9);
+    for (int i = 0; i < 9; ++i) {
+      for (int j = 0; j < 4; ++j) ASSERT_EQ(t[j * 9 + i], a[i * 4 + j]);
+    }
+  }
+}
+
+TEST(TestSimd, matrix_ops) {
+  S21Matrix a(7, 9);
+  S21Matrix b(7, 9);
+  for (int i = 0; i < 7; ++i) {
+    for (int j = 0; j < 9; ++j) {
+      a(i, j) = i - j;
+      b(i, j) = i * j;
+    }
+  }
+
+  S21Matrix c = a + b;
+  S21Matrix d = a - b;
+  for (int i = 0; i < 7; ++i) {
+    for (int j = 0; j < 9; ++j) {
+      ASSERT_EQ(c(i, j), i - j + i * j);
+      ASSERT_EQ(d(i, j), i - j - i * j);
+    }
+  }
+
+  c *= 0.5;
+  ASSERT_EQ(c(6, 8), (6 - 8 + 48) * 0.5);
+  ASSERT_FALSE(c == a);
+  d = a;
+  d(6, 8) += 1e-7;
+  ASSERT_TRUE(d == a);
+  d(6, 8) += 1e-5;
+  ASSERT_FALSE(d == a);
+}
+
+TEST(TestThreadPool, parallel_for) {
+  S21ThreadPool& pool = S21ThreadPool::Instance();
+  ASSERT_GE(pool.GetThreadCount(), 1);
+  EXPECT_THROW(pool.SetThreadCount(-1), std::invalid_argument);
+
+  pool.SetThreadCount(4);
+  ASSERT_EQ(pool.GetThreadCount(), 4);
+
+  std::vector<int> hits(100, 0);
+  pool.ParallelFor(100, [&](int task) {
+    pool.ParallelFor(1, [&](int) { ++hits[task]; });
+  });
+  for (int hit : hits) ASSERT_EQ(hit, 1);
+
+  EXPECT_THROW(pool.ParallelFor(8,
+                                [](int task) {
+                                  if (task == 5) throw std::runtime_error("");
+                                }),
+               std::runtime_error);
+
+  pool.SetThreadCount(0);
+  ASSERT_GE(pool.GetThreadCount(), 1);
+}
+
+TEST(TestThreadPool, mul_parallel) {
+  S21Matrix a(301, 257);
+  S21Matrix b(257, 263);
+  for (int i = 0; i < a.GetRows(); ++i) {
+    for (int j = 0; j < a.GetCols(); ++j) a(i, j) = (i + 2 * j) % 7 - 3;
+  }
+  for (int i = 0; i < b.GetRows(); ++i) {
+    for (int j = 0; j < b.GetCols(); ++j) b(i, j) = (3 * i + j) % 5 - 2;
+  }
+
+  S21ThreadPool& pool = S21ThreadPool::Instance();
+  pool.SetThreadCount(1);
+  S21Matrix serial = a * b;
+  pool.SetThreadCount(3);
+  S21Matrix parallel = a * b;
+  pool.SetThreadCount(0);
+
+  ASSERT_TRUE(serial == parallel);
+  ASSERT_EQ(serial(300, 262), parallel(300, 262));
+}
+
+TEST(TestPool, recycles_buffers) {
+  S21MatrixPool& pool = S21MatrixPool::Local();
+  S21Matrix a(40, 30), b(40, 30), square(30, 30);
+  a(39, 29) = 1;
+  b(39, 29) = 2;
+  S21Matrix warm = a + b;
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(warm.Data()) % 64, 0u);
+  { S21Matrix first = a + b, lu = square.Transpose(); }
+
+  long heap_before = array_allocations;
+  S21MatrixPool::Stats before = pool.GetStats();
+  for (int i = 0; i < 100; ++i) {
+    S21Matrix sum = a + b;
+    ASSERT_EQ(sum(39, 29), 3);
+    ASSERT_EQ(square.Determinant(), 0);
+  }
+  S21MatrixPool::Stats after = pool.GetStats();
+  ASSERT_EQ(array_allocations, heap_before);
+  ASSERT_EQ(after.requests - before.requests, 200);
+  ASSERT_EQ(after.reused - before.reused, 200);
+
+  std::size_t limit = pool.GetCacheLimit();
+  pool.SetCacheLimit(0);
+  for (int i = 0; i < 10; ++i) S21Matrix sum = a + b;
+  pool.SetCacheLimit(limit);
+  ASSERT_EQ(array_allocations - heap_before, 10);
+  ASSERT_EQ(pool.GetStats().reused, after.reused);
+
+  std::thread worker([&] {
+    S21Matrix local = a + b;
+    ASSERT_EQ(S21MatrixPool::Local().GetStats().requests, 1);
+    warm = std::move(local);
+  });
+  worker.join();
+  ASSERT_EQ(warm(39, 29), 3);
+}
+
+TEST(TestPool, arena) {
+  S21MatrixPool& pool = S21MatrixPool::Local();
+  S21Matrix a(16, 16);
+  for (int i = 0; i < 16; ++i) a(i, i) = 2;
+  S21Matrix outside(8, 8);
+
+  S21MatrixPool::Stats before = pool.GetStats();
+  {
+    S21MatrixArena arena(64 * 1024);
+    S21Matrix first = a * a;
+    long heap_before = array_allocations;
+    for (int i = 0; i < 20; ++i) {
+      S21Matrix sum = a + a;
+      ASSERT_EQ(sum(3, 3), 4);
+      ASSERT_EQ(reinterpret_cast<std::uintptr_t>(sum.Data()) % 64, 0u);
+    }
+    ASSERT_EQ(array_allocations, heap_before);
+    ASSERT_EQ(first(5, 5), 4);
+    ASSERT_GT(arena.GetUsed(), 21 * 16 * 16 * sizeof(double));
+
+    {
+      S21MatrixArena inner;
+      S21Matrix t = a.Transpose();
+      ASSERT_GT(inner.GetUsed(), 0u);
+      S21Matrix released(std::move(outside));
+    }
+    std::size_t used = arena.GetUsed();
+    S21Matrix again = a + a;
+    ASSERT_GT(arena.GetUsed(), used);
+  }
+  ASSERT_EQ(pool.GetStats().arena - before.arena, 23);
+
+  long heap_before = array_allocations;
+  S21Matrix after(8, 8);
+  ASSERT_EQ(array_allocations, heap_before);
+  after = a + a;
+  ASSERT_EQ(pool.GetStats().arena - before.arena, 23);
+  ASSERT_EQ(after(0, 0), 4);
+}
+
+TEST(TestPool, arena_spares_outer_matrices) {
+  S21MatrixPool& pool = S21MatrixPool::Local();
+  S21Matrix a(16, 16);
+  for (int i = 0; i < 16; ++i) a(i, i) = 2;
+  S21Matrix grown(8, 8), widened(8, 8), reserved(8, 8), appended(1, 20);
+  S21Matrix copied(8, 8), moved(8, 8), empty;
+  grown(7, 7) = 1;
+
+  S21MatrixPool::Stats before = pool.GetStats();
+  {
+    S21MatrixArena arena;
+    grown.SetRows(64);
+    grown(63, 7) = 5;
+    widened.SetCols(64);
+    reserved.Reserve(64, 64);
+    std::vector<double> row(20, 3);
+    for (int i = 0; i < 40; ++i) appended.AppendRow(row.data());
+    S21Matrix first = a + a;
+    copied = first;
+    moved = a + a;
+    empty = a + a;
+
+    S21Matrix local(8, 8);
+    local.SetRows(64);
+    ASSERT_EQ(S21MatrixPool::ArenaOf(local.Data()), &arena);
+    for (const S21Matrix* m : {&grown, &widened, &reserved, &appended,
+                               &copied, &moved, &empty}) {
+      ASSERT_EQ(S21MatrixPool::ArenaOf(m->Data()), nullptr);
+    }
+  }
+  ASSERT_EQ(pool.GetStats().arena - before.arena, 5);
+
+  ASSERT_EQ(grown(7, 7), 1);
+  ASSERT_EQ(grown(63, 7), 5);
+  ASSERT_EQ(widened.GetCols(), 64);
+  ASSERT_EQ(appended.GetRows(), 41);
+  ASSERT_EQ(appended(40, 19), 3);
+  ASSERT_EQ(copied(5, 5), 4);
+  ASSERT_EQ(moved(5, 5), 4);
+  ASSERT_EQ(empty(5, 5), 4);
+}
+
 int main(int argc, char *argv[]) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();